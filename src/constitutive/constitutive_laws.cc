@@ -880,6 +880,235 @@ namespace oomph
   }
 
 
+  //======================================================================
+  /// \short Helper function for the analytic derivatives of the stress
+  /// \f$ \sigma^{ij} = 2 C_1 G^{ik} \gamma_{kl} G^{lj}
+  /// + C_1 C_2 G^{ij} G^{kl} \gamma_{kl} - p G^{ij} \f$
+  /// with respect to the deformed metric tensor. The derivatives are
+  /// packed as in the finite-difference version in the base class: G(i,j)
+  /// and G(j,i) are varied simultaneously and only the "upper triangular"
+  /// entries are filled in unless symmetrize_tensor is true.
+  //======================================================================
+  void GeneralisedHookean::calculate_d_stress_dG(
+    const DenseMatrix<double>& g,
+    const DenseMatrix<double>& G,
+    const double& c2,
+    const double& p,
+    RankFourTensor<double>& d_sigma_dG,
+    DenseMatrix<double>* const& d_detG_dG_pt,
+    DenseMatrix<double>* const& d_gen_dil_dG_pt,
+    const bool& symmetrize_tensor)
+  {
+    // Initial error checking
+#ifdef PARANOID
+    // Test that the matrices are of the same dimension
+    if (!are_matrices_of_equal_dimensions(g, G))
+    {
+      throw OomphLibError("Matrices passed are not of equal dimension",
+                          OOMPH_CURRENT_FUNCTION,
+                          OOMPH_EXCEPTION_LOCATION);
+    }
+#endif
+
+    // Find the dimension of the problem
+    const unsigned dim = G.nrow();
+
+    // Calculate the contravariant deformed metric tensor
+    DenseMatrix<double> Gup(dim);
+    const double detG = calculate_contravariant(G, Gup);
+
+    // Premultiply the appropriate physical constant
+    const double C1 = (*E_pt) / (2.0 * (1.0 + (*Nu_pt)));
+
+    // Strain tensor and its trace G^{kl} gamma_{kl}
+    DenseMatrix<double> strain(dim, dim);
+    double trace = 0.0;
+    for (unsigned i = 0; i < dim; i++)
+    {
+      for (unsigned j = 0; j < dim; j++)
+      {
+        strain(i, j) = 0.5 * (G(i, j) - g(i, j));
+        trace += Gup(i, j) * strain(i, j);
+      }
+    }
+
+    // The tensor A^{ij} = G^{ik} gamma_{kl} G^{lj}
+    DenseMatrix<double> A(dim, dim, 0.0);
+    for (unsigned i = 0; i < dim; i++)
+    {
+      for (unsigned j = 0; j < dim; j++)
+      {
+        for (unsigned k = 0; k < dim; k++)
+        {
+          for (unsigned l = 0; l < dim; l++)
+          {
+            A(i, j) += Gup(i, k) * strain(k, l) * Gup(l, j);
+          }
+        }
+      }
+    }
+
+    // Loop over the "upper" components of the metric tensor
+    for (unsigned i = 0; i < dim; i++)
+    {
+      for (unsigned j = i; j < dim; j++)
+      {
+        // Initialise
+        if (d_detG_dG_pt != 0)
+        {
+          (*d_detG_dG_pt)(i, j) = 0.0;
+        }
+        if (d_gen_dil_dG_pt != 0)
+        {
+          (*d_gen_dil_dG_pt)(i, j) = 0.0;
+        }
+        for (unsigned ii = 0; ii < dim; ii++)
+        {
+          for (unsigned jj = ii; jj < dim; jj++)
+          {
+            d_sigma_dG(ii, jj, i, j) = 0.0;
+          }
+        }
+
+        // G(i,j) and G(j,i) vary together, so add the contributions from
+        // both (distinct) components
+        const unsigned n_component = (i == j) ? 1 : 2;
+        for (unsigned c = 0; c < n_component; c++)
+        {
+          const unsigned m = (c == 0) ? i : j;
+          const unsigned n = (c == 0) ? j : i;
+
+          // Derivative of the trace G^{kl} gamma_{kl} wrt G_{mn}
+          const double d_trace = 0.5 * Gup(m, n) - A(m, n);
+
+          if (d_detG_dG_pt != 0)
+          {
+            (*d_detG_dG_pt)(i, j) += detG * Gup(m, n);
+          }
+          if (d_gen_dil_dG_pt != 0)
+          {
+            (*d_gen_dil_dG_pt)(i, j) += d_trace;
+          }
+
+          for (unsigned ii = 0; ii < dim; ii++)
+          {
+            for (unsigned jj = ii; jj < dim; jj++)
+            {
+              // Derivatives of G^{ii jj} and A^{ii jj} wrt G_{mn}
+              const double d_Gup = -Gup(ii, m) * Gup(n, jj);
+              const double d_A =
+                -Gup(ii, m) * A(n, jj) - A(ii, m) * Gup(n, jj) - 0.5 * d_Gup;
+
+              d_sigma_dG(ii, jj, i, j) +=
+                2.0 * C1 * d_A +
+                C1 * c2 * (d_Gup * trace + Gup(ii, jj) * d_trace) - p * d_Gup;
+            }
+          }
+        }
+      }
+    }
+
+    // If we are symmetrising the tensor, do so
+    if (symmetrize_tensor)
+    {
+      for (unsigned i = 0; i < dim; i++)
+      {
+        for (unsigned j = 0; j < i; j++)
+        {
+          if (d_detG_dG_pt != 0)
+          {
+            (*d_detG_dG_pt)(i, j) = (*d_detG_dG_pt)(j, i);
+          }
+          if (d_gen_dil_dG_pt != 0)
+          {
+            (*d_gen_dil_dG_pt)(i, j) = (*d_gen_dil_dG_pt)(j, i);
+          }
+
+          for (unsigned ii = 0; ii < dim; ii++)
+          {
+            for (unsigned jj = 0; jj < ii; jj++)
+            {
+              d_sigma_dG(ii, jj, i, j) = d_sigma_dG(jj, ii, j, i);
+            }
+          }
+        }
+      }
+    }
+  }
+
+
+  //======================================================================
+  /// \short Calculate the derivatives of the contravariant
+  /// 2nd Piola Kirchhoff stress tensor with respect to the deformed metric
+  /// tensor analytically.
+  //======================================================================
+  void GeneralisedHookean::calculate_d_second_piola_kirchhoff_stress_dG(
+    const DenseMatrix<double>& g,
+    const DenseMatrix<double>& G,
+    const DenseMatrix<double>& sigma,
+    RankFourTensor<double>& d_sigma_dG,
+    const bool& symmetrize_tensor)
+  {
+    const double C2 = 2.0 * (*Nu_pt) / (1.0 - 2.0 * (*Nu_pt));
+    calculate_d_stress_dG(g, G, C2, 0.0, d_sigma_dG, 0, 0, symmetrize_tensor);
+  }
+
+
+  //======================================================================
+  /// \short Calculate the derivatives of the contravariant
+  /// 2nd Piola Kirchhoff stress tensor and of the determinant of the
+  /// deformed metric tensor with respect to the deformed metric tensor
+  /// analytically. Version for truly-incompressible materials.
+  //======================================================================
+  void GeneralisedHookean::calculate_d_second_piola_kirchhoff_stress_dG(
+    const DenseMatrix<double>& g,
+    const DenseMatrix<double>& G,
+    const DenseMatrix<double>& sigma,
+    const double& detG,
+    const double& interpolated_solid_p,
+    RankFourTensor<double>& d_sigma_dG,
+    DenseMatrix<double>& d_detG_dG,
+    const bool& symmetrize_tensor)
+  {
+    calculate_d_stress_dG(g,
+                          G,
+                          0.0,
+                          interpolated_solid_p,
+                          d_sigma_dG,
+                          &d_detG_dG,
+                          0,
+                          symmetrize_tensor);
+  }
+
+
+  //======================================================================
+  /// \short Calculate the derivatives of the contravariant
+  /// 2nd Piola Kirchhoff stress tensor and of the generalised dilatation
+  /// with respect to the deformed metric tensor analytically. Version for
+  /// near-incompressible materials.
+  //======================================================================
+  void GeneralisedHookean::calculate_d_second_piola_kirchhoff_stress_dG(
+    const DenseMatrix<double>& g,
+    const DenseMatrix<double>& G,
+    const DenseMatrix<double>& sigma,
+    const double& gen_dil,
+    const double& inv_kappa,
+    const double& interpolated_solid_p,
+    RankFourTensor<double>& d_sigma_dG,
+    DenseMatrix<double>& d_gen_dil_dG,
+    const bool& symmetrize_tensor)
+  {
+    calculate_d_stress_dG(g,
+                          G,
+                          0.0,
+                          interpolated_solid_p,
+                          d_sigma_dG,
+                          0,
+                          &d_gen_dil_dG,
+                          symmetrize_tensor);
+  }
+
+
   /////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////
@@ -1264,4 +1493,376 @@ namespace oomph
     }
   }
 
+
+  //===========================================================================
+  /// \short Helper function for the analytic derivatives of the stress
+  /// with respect to the deformed metric tensor in the specified
+  /// formulation. The derivatives are packed as in the finite-difference
+  /// version in the base class: G(i,j) and G(j,i) are varied simultaneously
+  /// and only the "upper triangular" entries are filled in unless
+  /// symmetrize_tensor is true. Uses the same (plane strain) invariants
+  /// as the computation of the stress itself.
+  //===========================================================================
+  void IsotropicStrainEnergyFunctionConstitutiveLaw::calculate_d_stress_dG(
+    const DenseMatrix<double>& g,
+    const DenseMatrix<double>& G,
+    const Formulation& formulation,
+    const double& p,
+    RankFourTensor<double>& d_sigma_dG,
+    DenseMatrix<double>& d_scalar_dG,
+    const bool& symmetrize_tensor)
+  {
+    // Initial error checking
+#ifdef PARANOID
+    // Test that the matrices are of the same dimension
+    if (!are_matrices_of_equal_dimensions(g, G))
+    {
+      throw OomphLibError("Matrices passed are not of equal dimension",
+                          OOMPH_CURRENT_FUNCTION,
+                          OOMPH_EXCEPTION_LOCATION);
+    }
+#endif
+
+    // Find the dimension of the problem
+    const unsigned dim = g.nrow();
+
+    // Calculate the contravariant undeformed and deformed metric tensors
+    // and get the determinants of the metric tensors
+    DenseMatrix<double> gup(dim), Gup(dim);
+    const double detg = calculate_contravariant(g, gup);
+    const double detG = calculate_contravariant(G, Gup);
+
+    // Calculate the strain invariants exactly as for the stress.
+    // I1_raw is the second invariant before it's multiplied by the third.
+    Vector<double> I(3, 0.0);
+    double I1_raw = 0.0;
+    for (unsigned i = 0; i < dim; i++)
+    {
+      for (unsigned j = 0; j < dim; j++)
+      {
+        I[0] += gup(i, j) * G(i, j);
+        I1_raw += g(i, j) * Gup(i, j);
+      }
+    }
+    if (dim == 2)
+    {
+      I[0] += 1.0;
+      I1_raw += 1.0;
+    }
+    if (formulation == Incompressible)
+    {
+      I[2] = 1.0;
+      I[1] = I1_raw;
+    }
+    else
+    {
+      I[2] = detG / detg;
+      I[1] = I1_raw * I[2];
+    }
+
+    // First and second derivatives of the strain energy function
+    Vector<double> dWdI(3, 0.0);
+    Strain_energy_function_pt->derivatives(I, dWdI);
+    DenseMatrix<double> d2WdI2(3, 3, 0.0);
+    Strain_energy_function_pt->second_derivatives(I, d2WdI2);
+
+    // The tensors g^{ir} G_{rs} g^{sj}, B^{ij} (Green & Zerna notation)
+    // and G^{ir} g_{rs} G^{sj}
+    DenseMatrix<double> gGg(dim, dim, 0.0);
+    DenseMatrix<double> Bup(dim, dim, 0.0);
+    DenseMatrix<double> GgG(dim, dim, 0.0);
+    for (unsigned i = 0; i < dim; i++)
+    {
+      for (unsigned j = 0; j < dim; j++)
+      {
+        for (unsigned r = 0; r < dim; r++)
+        {
+          for (unsigned s = 0; s < dim; s++)
+          {
+            gGg(i, j) += gup(i, r) * G(r, s) * gup(s, j);
+            GgG(i, j) += Gup(i, r) * g(r, s) * Gup(s, j);
+          }
+        }
+        Bup(i, j) = I[0] * gup(i, j) - gGg(i, j);
+      }
+    }
+
+    // The functions phi and psi (Green & Zerna notation)
+    const double phi = 2.0 * dWdI[0];
+    const double psi = 2.0 * dWdI[1];
+
+    // The (compressible) pressure
+    const double p_comp = 2.0 * dWdI[2] * I[2];
+
+    // The trace/dim K of phi g^{ij} + psi B^{ij} and, in two-d,
+    // the contraction S = B^{ij} G_{ij} used to compute it
+    double K = 0.0;
+    double S = 0.0;
+    if (formulation != Compressible)
+    {
+      if (dim == 2)
+      {
+        for (unsigned i = 0; i < dim; i++)
+        {
+          for (unsigned j = 0; j < dim; j++)
+          {
+            S += Bup(i, j) * G(i, j);
+          }
+        }
+        K = 0.5 * ((I[0] - 1.0) * phi + psi * S);
+      }
+      else
+      {
+        K = (I[0] * phi + 2.0 * I[1] * psi) / 3.0;
+      }
+    }
+
+    // Loop over the "upper" components of the metric tensor
+    Vector<double> dI(3);
+    Vector<double> d_dWdI(3);
+    for (unsigned i = 0; i < dim; i++)
+    {
+      for (unsigned j = i; j < dim; j++)
+      {
+        // Initialise
+        if (formulation != Compressible)
+        {
+          d_scalar_dG(i, j) = 0.0;
+        }
+        for (unsigned ii = 0; ii < dim; ii++)
+        {
+          for (unsigned jj = ii; jj < dim; jj++)
+          {
+            d_sigma_dG(ii, jj, i, j) = 0.0;
+          }
+        }
+
+        // G(i,j) and G(j,i) vary together, so add the contributions from
+        // both (distinct) components
+        const unsigned n_component = (i == j) ? 1 : 2;
+        for (unsigned c = 0; c < n_component; c++)
+        {
+          const unsigned m = (c == 0) ? i : j;
+          const unsigned n = (c == 0) ? j : i;
+
+          // Derivatives of the strain invariants wrt G_{mn}
+          dI[0] = gup(m, n);
+          if (formulation == Incompressible)
+          {
+            dI[1] = -GgG(m, n);
+            dI[2] = 0.0;
+          }
+          else
+          {
+            dI[2] = I[2] * Gup(m, n);
+            dI[1] = -GgG(m, n) * I[2] + I1_raw * dI[2];
+          }
+
+          // Derivatives of dW/dI wrt G_{mn}
+          for (unsigned k = 0; k < 3; k++)
+          {
+            d_dWdI[k] = 0.0;
+            for (unsigned l = 0; l < 3; l++)
+            {
+              d_dWdI[k] += d2WdI2(k, l) * dI[l];
+            }
+          }
+          const double d_phi = 2.0 * d_dWdI[0];
+          const double d_psi = 2.0 * d_dWdI[1];
+          const double d_p_comp = 2.0 * (d_dWdI[2] * I[2] + dWdI[2] * dI[2]);
+
+          // Derivative of K
+          double d_K = 0.0;
+          if (formulation != Compressible)
+          {
+            if (dim == 2)
+            {
+              const double d_S = Bup(m, n) + dI[0] * (I[0] - 1.0) - gGg(m, n);
+              d_K = 0.5 * (dI[0] * phi + (I[0] - 1.0) * d_phi + d_psi * S +
+                           psi * d_S);
+            }
+            else
+            {
+              d_K = (dI[0] * phi + I[0] * d_phi +
+                     2.0 * (dI[1] * psi + I[1] * d_psi)) /
+                    3.0;
+            }
+          }
+
+          // Derivative of the determinant or the generalised dilatation
+          if (formulation == Incompressible)
+          {
+            d_scalar_dG(i, j) += detG * Gup(m, n);
+          }
+          else if (formulation == NearlyIncompressible)
+          {
+            d_scalar_dG(i, j) += d_p_comp + d_K;
+          }
+
+          for (unsigned ii = 0; ii < dim; ii++)
+          {
+            for (unsigned jj = ii; jj < dim; jj++)
+            {
+              // Derivatives of G^{ii jj} and B^{ii jj} wrt G_{mn}
+              const double d_Gup = -Gup(ii, m) * Gup(n, jj);
+              const double d_Bup =
+                dI[0] * gup(ii, jj) - gup(ii, m) * gup(n, jj);
+
+              double d_sigma =
+                d_phi * gup(ii, jj) + d_psi * Bup(ii, jj) + psi * d_Bup;
+              if (formulation == Compressible)
+              {
+                d_sigma += d_p_comp * Gup(ii, jj) + p_comp * d_Gup;
+              }
+              else
+              {
+                d_sigma -= d_K * Gup(ii, jj) + (K + p) * d_Gup;
+              }
+              d_sigma_dG(ii, jj, i, j) += d_sigma;
+            }
+          }
+        }
+      }
+    }
+
+    // If we are symmetrising the tensor, do so
+    if (symmetrize_tensor)
+    {
+      for (unsigned i = 0; i < dim; i++)
+      {
+        for (unsigned j = 0; j < i; j++)
+        {
+          if (formulation != Compressible)
+          {
+            d_scalar_dG(i, j) = d_scalar_dG(j, i);
+          }
+
+          for (unsigned ii = 0; ii < dim; ii++)
+          {
+            for (unsigned jj = 0; jj < ii; jj++)
+            {
+              d_sigma_dG(ii, jj, i, j) = d_sigma_dG(jj, ii, j, i);
+            }
+          }
+        }
+      }
+    }
+  }
+
+
+  //===========================================================================
+  /// \short Calculate the derivatives of the contravariant
+  /// 2nd Piola Kirchhoff stress tensor with respect to the deformed metric
+  /// tensor. Analytic if the strain energy function provides second
+  /// derivatives, finite differences otherwise.
+  //===========================================================================
+  void IsotropicStrainEnergyFunctionConstitutiveLaw::
+    calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      RankFourTensor<double>& d_sigma_dG,
+      const bool& symmetrize_tensor)
+  {
+    if (!Strain_energy_function_pt->has_second_derivatives())
+    {
+      ConstitutiveLaw::calculate_d_second_piola_kirchhoff_stress_dG(
+        g, G, sigma, d_sigma_dG, symmetrize_tensor);
+      return;
+    }
+
+    // Dummy matrix: There's no additional scalar in this formulation
+    DenseMatrix<double> dummy;
+    calculate_d_stress_dG(
+      g, G, Compressible, 0.0, d_sigma_dG, dummy, symmetrize_tensor);
+  }
+
+
+  //===========================================================================
+  /// \short Calculate the derivatives of the contravariant
+  /// 2nd Piola Kirchhoff stress tensor and of the determinant of the
+  /// deformed metric tensor with respect to the deformed metric tensor.
+  /// Analytic if the strain energy function provides second derivatives,
+  /// finite differences otherwise. Version for the pure incompressible
+  /// formulation.
+  //===========================================================================
+  void IsotropicStrainEnergyFunctionConstitutiveLaw::
+    calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      const double& detG,
+      const double& interpolated_solid_p,
+      RankFourTensor<double>& d_sigma_dG,
+      DenseMatrix<double>& d_detG_dG,
+      const bool& symmetrize_tensor)
+  {
+    if (!Strain_energy_function_pt->has_second_derivatives())
+    {
+      ConstitutiveLaw::calculate_d_second_piola_kirchhoff_stress_dG(
+        g,
+        G,
+        sigma,
+        detG,
+        interpolated_solid_p,
+        d_sigma_dG,
+        d_detG_dG,
+        symmetrize_tensor);
+      return;
+    }
+
+    calculate_d_stress_dG(g,
+                          G,
+                          Incompressible,
+                          interpolated_solid_p,
+                          d_sigma_dG,
+                          d_detG_dG,
+                          symmetrize_tensor);
+  }
+
+
+  //===========================================================================
+  /// \short Calculate the derivatives of the contravariant
+  /// 2nd Piola Kirchhoff stress tensor and of the generalised dilatation
+  /// with respect to the deformed metric tensor.
+  /// Analytic if the strain energy function provides second derivatives,
+  /// finite differences otherwise. Version for the near-incompressible
+  /// formulation.
+  //===========================================================================
+  void IsotropicStrainEnergyFunctionConstitutiveLaw::
+    calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      const double& gen_dil,
+      const double& inv_kappa,
+      const double& interpolated_solid_p,
+      RankFourTensor<double>& d_sigma_dG,
+      DenseMatrix<double>& d_gen_dil_dG,
+      const bool& symmetrize_tensor)
+  {
+    if (!Strain_energy_function_pt->has_second_derivatives())
+    {
+      ConstitutiveLaw::calculate_d_second_piola_kirchhoff_stress_dG(
+        g,
+        G,
+        sigma,
+        gen_dil,
+        inv_kappa,
+        interpolated_solid_p,
+        d_sigma_dG,
+        d_gen_dil_dG,
+        symmetrize_tensor);
+      return;
+    }
+
+    calculate_d_stress_dG(g,
+                          G,
+                          NearlyIncompressible,
+                          interpolated_solid_p,
+                          d_sigma_dG,
+                          d_gen_dil_dG,
+                          symmetrize_tensor);
+  }
+
 } // namespace oomph
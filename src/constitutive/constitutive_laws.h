@@ -122,6 +122,29 @@ namespace oomph
       }
     }
 
+    /// \short Return the second derivatives of the strain energy function
+    /// with respect to the strain invariants,
+    /// d2WdI2(i,j) = \f$ \partial^2 W / \partial I_i \partial I_j \f$.
+    /// Only needs to be implemented if has_second_derivatives() returns
+    /// true; constitutive laws fall back to finite-differencing the stress
+    /// otherwise.
+    virtual void second_derivatives(Vector<double>& I,
+                                    DenseMatrix<double>& d2WdI2)
+    {
+      throw OomphLibError(
+        "Second derivatives not implemented for this strain energy function",
+        OOMPH_CURRENT_FUNCTION,
+        OOMPH_EXCEPTION_LOCATION);
+    }
+
+    /// \short Does the strain energy function provide (analytic) second
+    /// derivatives with respect to the strain invariants? If so, the
+    /// derivatives of the stress can be computed analytically. Default: false
+    virtual bool has_second_derivatives()
+    {
+      return false;
+    }
+
     /// \short Pure virtual function in which the user must declare if the
     /// constitutive equation requires an incompressible formulation
     /// in which the volume constraint is enforced explicitly.
@@ -177,6 +200,20 @@ namespace oomph
       dWdI[2] = 0.0;
     }
 
+    /// \short Return the second derivatives of the strain energy function
+    /// with respect to the strain invariants (all zero)
+    void second_derivatives(Vector<double>& I, DenseMatrix<double>& d2WdI2)
+    {
+      d2WdI2.resize(3, 3, 0.0);
+      d2WdI2.initialise(0.0);
+    }
+
+    /// Second derivatives are available analytically
+    bool has_second_derivatives()
+    {
+      return true;
+    }
+
     /// \short Pure virtual function in which the user must declare if the
     /// constitutive equation requires an incompressible formulation
     /// in which the volume constraint is enforced explicitly.
@@ -276,6 +313,23 @@ namespace oomph
                          (2.0 * (1.0 - 2.0 * (*Nu_pt))));
     }
 
+    /// \short Return the second derivatives of the strain energy function
+    /// with respect to the strain invariants; only the one wrt the third
+    /// invariant is non-zero.
+    void second_derivatives(Vector<double>& I, DenseMatrix<double>& d2WdI2)
+    {
+      double G = (*E_pt) / (2.0 * (1.0 + (*Nu_pt)));
+      d2WdI2.resize(3, 3, 0.0);
+      d2WdI2.initialise(0.0);
+      d2WdI2(2, 2) = (1.0 - (*Nu_pt)) * G / (2.0 * (1.0 - 2.0 * (*Nu_pt)));
+    }
+
+    /// Second derivatives are available analytically
+    bool has_second_derivatives()
+    {
+      return true;
+    }
+
 
     /// \short Pure virtual function in which the user must declare if the
     /// constitutive equation requires an incompressible formulation
@@ -754,6 +808,17 @@ namespace oomph
                                                  DenseMatrix<double>& sigma);
 
 
+    /// \short Calculate the derivatives of the contravariant
+    /// 2nd Piola Kirchhoff stress tensor with respect to the deformed metric
+    /// tensor analytically. Arguments are as in the base class.
+    void calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      RankFourTensor<double>& d_sigma_dG,
+      const bool& symmetrize_tensor = true);
+
+
     /// \short Calculate the deviatoric part
     /// \f$ \overline{ \sigma^{ij}}\f$  of the contravariant
     /// 2nd Piola Kirchhoff stress tensor \f$ \sigma^{ij}\f$.
@@ -771,6 +836,22 @@ namespace oomph
                                                  double& Gdet);
 
 
+    /// \short Calculate the derivatives of the contravariant
+    /// 2nd Piola Kirchhoff stress tensor and of the determinant of the
+    /// deformed metric tensor with respect to the deformed metric tensor
+    /// analytically. This form is appropriate for truly-incompressible
+    /// materials.
+    void calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      const double& detG,
+      const double& interpolated_solid_p,
+      RankFourTensor<double>& d_sigma_dG,
+      DenseMatrix<double>& d_detG_dG,
+      const bool& symmetrize_tensor = true);
+
+
     /// \short Calculate the deviatoric part of the contravariant
     /// 2nd Piola Kirchoff stress tensor. Also return the contravariant
     /// deformed metric tensor, the generalised dilatation, \f$ d, \f$ and
@@ -787,6 +868,22 @@ namespace oomph
                                                  double& inv_kappa);
 
 
+    /// \short Calculate the derivatives of the contravariant
+    /// 2nd Piola Kirchhoff stress tensor and of the generalised dilatation
+    /// with respect to the deformed metric tensor analytically. This form
+    /// is appropriate for near-incompressible materials.
+    void calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      const double& gen_dil,
+      const double& inv_kappa,
+      const double& interpolated_solid_p,
+      RankFourTensor<double>& d_sigma_dG,
+      DenseMatrix<double>& d_gen_dil_dG,
+      const bool& symmetrize_tensor = true);
+
+
     /// \short Pure virtual function in which the writer must declare if the
     /// constitutive equation requires an incompressible formulation
     /// in which the volume constraint is enforced explicitly.
@@ -797,6 +894,25 @@ namespace oomph
     }
 
   private:
+    /// \short Helper function for the analytic derivatives of the stress
+    /// \f$ \sigma^{ij} = 2 C_1 G^{ik} \gamma_{kl} G^{lj}
+    /// + C_1 C_2 G^{ij} G^{kl} \gamma_{kl} - p G^{ij} \f$
+    /// with respect to the deformed metric tensor, where
+    /// \f$ C_1 = E/(2(1+\nu)) \f$. The three public versions differ in
+    /// the choice of c2 and p, and in the additional scalar whose
+    /// derivatives they require: the determinant of the deformed metric
+    /// tensor (truly incompressible) or the generalised dilatation (near
+    /// incompressible). The pointers to the associated matrices
+    /// may be null if they are not required.
+    void calculate_d_stress_dG(const DenseMatrix<double>& g,
+                               const DenseMatrix<double>& G,
+                               const double& c2,
+                               const double& p,
+                               RankFourTensor<double>& d_sigma_dG,
+                               DenseMatrix<double>* const& d_detG_dG_pt,
+                               DenseMatrix<double>* const& d_gen_dil_dG_pt,
+                               const bool& symmetrize_tensor);
+
     /// Poisson ratio
     double* Nu_pt;
 
@@ -824,6 +940,29 @@ namespace oomph
     /// Pointer to the strain energy function
     StrainEnergyFunction* Strain_energy_function_pt;
 
+    /// \short Enumeration of the three formulations of the constitutive law
+    enum Formulation
+    {
+      Compressible,
+      Incompressible,
+      NearlyIncompressible
+    };
+
+    /// \short Helper function for the analytic derivatives of the stress
+    /// with respect to the deformed metric tensor in the specified
+    /// formulation, given the second derivatives of the strain energy
+    /// function. For the (nearly) incompressible formulations, p is the
+    /// interpolated pressure and d_scalar_dG returns the derivatives of
+    /// the determinant of the deformed metric tensor or of the generalised
+    /// dilatation, respectively; it is not used in the compressible case.
+    void calculate_d_stress_dG(const DenseMatrix<double>& g,
+                               const DenseMatrix<double>& G,
+                               const Formulation& formulation,
+                               const double& p,
+                               RankFourTensor<double>& d_sigma_dG,
+                               DenseMatrix<double>& d_scalar_dG,
+                               const bool& symmetrize_tensor);
+
   public:
     /// Constructor takes a pointer to the strain energy function
     IsotropicStrainEnergyFunctionConstitutiveLaw(
@@ -842,6 +981,18 @@ namespace oomph
                                                  DenseMatrix<double>& sigma);
 
 
+    /// \short Calculate the derivatives of the contravariant
+    /// 2nd Piola Kirchhoff stress tensor with respect to the deformed metric
+    /// tensor analytically if the strain energy function provides
+    /// second derivatives; otherwise use the finite-difference default.
+    void calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      RankFourTensor<double>& d_sigma_dG,
+      const bool& symmetrize_tensor = true);
+
+
     /// \short Calculate the deviatoric part
     /// \f$ \overline{ \sigma^{ij}}\f$  of the contravariant
     /// 2nd Piola Kirchhoff stress tensor \f$ \sigma^{ij}\f$.
@@ -859,6 +1010,23 @@ namespace oomph
                                                  double& Gdet);
 
 
+    /// \short Calculate the derivatives of the contravariant
+    /// 2nd Piola Kirchhoff stress tensor and of the determinant of the
+    /// deformed metric tensor with respect to the deformed metric tensor
+    /// analytically (or by finite differences if the strain energy function
+    /// does not provide second derivatives). This form is appropriate for
+    /// truly-incompressible materials.
+    void calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      const double& detG,
+      const double& interpolated_solid_p,
+      RankFourTensor<double>& d_sigma_dG,
+      DenseMatrix<double>& d_detG_dG,
+      const bool& symmetrize_tensor = true);
+
+
     /// \short Calculate the deviatoric part of the contravariant
     /// 2nd Piola Kirchoff stress tensor. Also return the contravariant
     /// deformed metric tensor, the generalised dilatation, \f$ d, \f$ and
@@ -875,6 +1043,24 @@ namespace oomph
                                                  double& inv_kappa);
 
 
+    /// \short Calculate the derivatives of the contravariant
+    /// 2nd Piola Kirchhoff stress tensor and of the generalised dilatation
+    /// with respect to the deformed metric tensor analytically (or by
+    /// finite differences if the strain energy function does not provide
+    /// second derivatives). This form is appropriate for near-incompressible
+    /// materials.
+    void calculate_d_second_piola_kirchhoff_stress_dG(
+      const DenseMatrix<double>& g,
+      const DenseMatrix<double>& G,
+      const DenseMatrix<double>& sigma,
+      const double& gen_dil,
+      const double& inv_kappa,
+      const double& interpolated_solid_p,
+      RankFourTensor<double>& d_sigma_dG,
+      DenseMatrix<double>& d_gen_dil_dG,
+      const bool& symmetrize_tensor = true);
+
+
     /// \short State if the constitutive equation requires an incompressible
     /// formulation in which the volume constraint is enforced explicitly.
     /// Used as a sanity check in PARANOID mode. This is determined
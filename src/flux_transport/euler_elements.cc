@@ -181,4 +181,352 @@ namespace oomph
   template class DGSpectralEulerElement<2, 3>;
   template class DGSpectralEulerElement<2, 4>;
 
+  template<unsigned NNODE_1D>
+  const unsigned DGSpectralEulerElement<3, NNODE_1D>::Nintpt_1d;
+
+  template<unsigned NNODE_1D>
+  GaussLobattoLegendre<3, DGSpectralEulerElement<3, NNODE_1D>::Nintpt_1d>
+    DGSpectralEulerElement<3, NNODE_1D>::Default_integration_scheme;
+
+  template<unsigned NNODE_1D>
+  Gauss<2, NNODE_1D>
+    DGSpectralEulerElement<3, NNODE_1D>::Default_face_integration_scheme;
+
+
+  //======================================================================
+  /// Add the volume contributions to the residuals by sum factorisation.
+  /// The unknowns, their time derivatives and the geometry are
+  /// interpolated to the knots direction by direction; the fluxes are
+  /// evaluated pointwise and then integrated against the derivatives of
+  /// the test functions in the same way. This reduces the cost from
+  /// O(NNODE_1D^6) to O(NNODE_1D^4) and requires no shape function storage
+  /// beyond the one-dimensional matrices. The result is the same as that
+  /// of the generic version with flag=0.
+  //======================================================================
+  template<unsigned NNODE_1D>
+  void DGSpectralEulerElement<3, NNODE_1D>::
+    fill_in_residuals_by_sum_factorisation(Vector<double>& residuals)
+  {
+    const unsigned n_node = NNODE_1D * NNODE_1D * NNODE_1D;
+    const unsigned n_flux = 5;
+
+    const double* const psi = &SumFactorisation::Psi[0];
+    const double* const dpsi = &SumFactorisation::Dpsi[0];
+
+    // One-dimensional matrices to apply in each coordinate direction to
+    // interpolate (a_interpolate) and to differentiate w.r.t. the k-th
+    // local coordinate (a_derivative[k])
+    const double* const a_interpolate[3] = {psi, psi, psi};
+    const double* const a_derivative[3][3] = {
+      {dpsi, psi, psi}, {psi, dpsi, psi}, {psi, psi, dpsi}};
+
+    // Do we need the time derivatives? The explicit timesteppers
+    // use steady timesteppers at the nodes
+    const bool unsteady = !this->node_pt(0)->time_stepper_pt()->is_steady();
+
+    // Gather the nodal values (one contiguous array per field)
+    double u_nodal[5][NNODE_1D * NNODE_1D * NNODE_1D];
+    double dudt_nodal[5][NNODE_1D * NNODE_1D * NNODE_1D];
+    double x_nodal[3][NNODE_1D * NNODE_1D * NNODE_1D];
+    unsigned u_nodal_index[5];
+    for (unsigned i = 0; i < n_flux; i++)
+    {
+      u_nodal_index[i] = this->u_index_flux_transport(i);
+    }
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      for (unsigned i = 0; i < n_flux; i++)
+      {
+        u_nodal[i][l] = this->nodal_value(l, u_nodal_index[i]);
+        if (unsteady)
+        {
+          dudt_nodal[i][l] = this->du_dt_flux_transport(l, i);
+        }
+      }
+      for (unsigned j = 0; j < 3; j++)
+      {
+        x_nodal[j][l] = this->nodal_position(l, j);
+      }
+    }
+
+    // Interpolate the unknowns and their time derivatives to the knots
+    double u_knot[5][Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    double dudt_knot[5][Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    for (unsigned i = 0; i < n_flux; i++)
+    {
+      SumFactorisation::interpolate_to_knots(
+        a_interpolate, u_nodal[i], u_knot[i]);
+      if (unsteady)
+      {
+        SumFactorisation::interpolate_to_knots(
+          a_interpolate, dudt_nodal[i], dudt_knot[i]);
+      }
+    }
+
+    // Derivatives of the global coordinates w.r.t. the local ones at the
+    // knots: dxds[k][j] = dx_j/ds_k
+    double dxds[3][3][Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    for (unsigned k = 0; k < 3; k++)
+    {
+      for (unsigned j = 0; j < 3; j++)
+      {
+        SumFactorisation::interpolate_to_knots(
+          a_derivative[k], x_nodal[j], dxds[k][j]);
+      }
+    }
+
+    // Weighted fluxes contracted with the inverse Jacobian of the
+    // mapping: flux_knot[i][k] = W F_{ij} ds_k/dx_j, and the weighted
+    // time derivatives
+    double flux_knot[5][3][Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    Vector<double> u(n_flux);
+    DenseMatrix<double> F(n_flux, 3);
+    for (unsigned q2 = 0, ipt = 0; q2 < Nintpt_1d; q2++)
+    {
+      for (unsigned q1 = 0; q1 < Nintpt_1d; q1++)
+      {
+        for (unsigned q0 = 0; q0 < Nintpt_1d; q0++, ipt++)
+        {
+          // Jacobian of the mapping and its inverse
+          double jac[3][3], inverse_jac[3][3];
+          for (unsigned k = 0; k < 3; k++)
+          {
+            for (unsigned j = 0; j < 3; j++)
+            {
+              jac[k][j] = dxds[k][j][ipt];
+            }
+          }
+          const double det =
+            jac[0][0] * jac[1][1] * jac[2][2] +
+            jac[0][1] * jac[1][2] * jac[2][0] +
+            jac[0][2] * jac[1][0] * jac[2][1] -
+            jac[0][0] * jac[1][2] * jac[2][1] -
+            jac[0][1] * jac[1][0] * jac[2][2] -
+            jac[0][2] * jac[1][1] * jac[2][0];
+
+#ifdef PARANOID
+          if (det == 0.0)
+          {
+            throw OomphLibError("Singular Jacobian of the mapping",
+                                OOMPH_CURRENT_FUNCTION,
+                                OOMPH_EXCEPTION_LOCATION);
+          }
+#endif
+
+          inverse_jac[0][0] =
+            (jac[1][1] * jac[2][2] - jac[1][2] * jac[2][1]) / det;
+          inverse_jac[0][1] =
+            -(jac[0][1] * jac[2][2] - jac[0][2] * jac[2][1]) / det;
+          inverse_jac[0][2] =
+            (jac[0][1] * jac[1][2] - jac[0][2] * jac[1][1]) / det;
+          inverse_jac[1][0] =
+            -(jac[1][0] * jac[2][2] - jac[1][2] * jac[2][0]) / det;
+          inverse_jac[1][1] =
+            (jac[0][0] * jac[2][2] - jac[0][2] * jac[2][0]) / det;
+          inverse_jac[1][2] =
+            -(jac[0][0] * jac[1][2] - jac[0][2] * jac[1][0]) / det;
+          inverse_jac[2][0] =
+            (jac[1][0] * jac[2][1] - jac[1][1] * jac[2][0]) / det;
+          inverse_jac[2][1] =
+            -(jac[0][0] * jac[2][1] - jac[0][1] * jac[2][0]) / det;
+          inverse_jac[2][2] =
+            (jac[0][0] * jac[1][1] - jac[0][1] * jac[1][0]) / det;
+
+          // Integration weight
+          const double W = SumFactorisation::Weight[q0] *
+                           SumFactorisation::Weight[q1] *
+                           SumFactorisation::Weight[q2] * det;
+
+          // Get the flux at the knot
+          for (unsigned i = 0; i < n_flux; i++)
+          {
+            u[i] = u_knot[i][ipt];
+          }
+          this->flux(u, F);
+
+          // dpsi/dx_j = sum_k (ds_k/dx_j) dpsi/ds_k, where
+          // ds_k/dx_j = inverse_jac[j][k]
+          for (unsigned i = 0; i < n_flux; i++)
+          {
+            for (unsigned k = 0; k < 3; k++)
+            {
+              double sum = 0.0;
+              for (unsigned j = 0; j < 3; j++)
+              {
+                sum += F(i, j) * inverse_jac[j][k];
+              }
+              flux_knot[i][k][ipt] = W * sum;
+            }
+            if (unsteady)
+            {
+              dudt_knot[i][ipt] *= -W;
+            }
+          }
+        }
+      }
+    }
+
+    // Integrate against the (derivatives of the) test functions
+    // and add to the residuals
+    double residuals_nodal[NNODE_1D * NNODE_1D * NNODE_1D];
+    for (unsigned i = 0; i < n_flux; i++)
+    {
+      for (unsigned l = 0; l < n_node; l++)
+      {
+        residuals_nodal[l] = 0.0;
+      }
+      for (unsigned k = 0; k < 3; k++)
+      {
+        SumFactorisation::add_integral_over_knots(
+          a_derivative[k], flux_knot[i][k], residuals_nodal);
+      }
+      if (unsteady)
+      {
+        SumFactorisation::add_integral_over_knots(
+          a_interpolate, dudt_knot[i], residuals_nodal);
+      }
+
+      for (unsigned l = 0; l < n_node; l++)
+      {
+        const int local_eqn = this->nodal_local_eqn(l, u_nodal_index[i]);
+        if (local_eqn >= 0)
+        {
+          residuals[local_eqn] += residuals_nodal[l];
+        }
+      }
+    }
+  }
+
+
+  //======================================================================
+  /// Add the mass matrix by sum factorisation. It has the same block for
+  /// each of the unknowns. The column associated with node l2 is the
+  /// integral of the weighted shape function psi_l2 against the test
+  /// functions; psi_l2 is a product of one-dimensional shape functions,
+  /// so its values at the knots need no interpolation. This reduces the
+  /// cost from O(NNODE_1D^9) to O(NNODE_1D^7). The result is the same as
+  /// that of the generic version with flag=3.
+  //======================================================================
+  template<unsigned NNODE_1D>
+  void DGSpectralEulerElement<3, NNODE_1D>::
+    fill_in_mass_matrix_by_sum_factorisation(DenseMatrix<double>& mass_matrix)
+  {
+    const unsigned n_node = NNODE_1D * NNODE_1D * NNODE_1D;
+    const unsigned n_flux = 5;
+
+    const double* const psi = &SumFactorisation::Psi[0];
+    const double* const dpsi = &SumFactorisation::Dpsi[0];
+    const double* const a_interpolate[3] = {psi, psi, psi};
+    const double* const a_derivative[3][3] = {
+      {dpsi, psi, psi}, {psi, dpsi, psi}, {psi, psi, dpsi}};
+
+    // Derivatives of the global coordinates w.r.t. the local ones at the
+    // knots: dxds[k][j] = dx_j/ds_k
+    double x_nodal[NNODE_1D * NNODE_1D * NNODE_1D];
+    double dxds[3][3][Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    for (unsigned j = 0; j < 3; j++)
+    {
+      for (unsigned l = 0; l < n_node; l++)
+      {
+        x_nodal[l] = this->nodal_position(l, j);
+      }
+      for (unsigned k = 0; k < 3; k++)
+      {
+        SumFactorisation::interpolate_to_knots(
+          a_derivative[k], x_nodal, dxds[k][j]);
+      }
+    }
+
+    // Integration weights (including the Jacobian of the mapping)
+    double W[Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    for (unsigned q2 = 0, ipt = 0; q2 < Nintpt_1d; q2++)
+    {
+      for (unsigned q1 = 0; q1 < Nintpt_1d; q1++)
+      {
+        for (unsigned q0 = 0; q0 < Nintpt_1d; q0++, ipt++)
+        {
+          double jac[3][3];
+          for (unsigned k = 0; k < 3; k++)
+          {
+            for (unsigned j = 0; j < 3; j++)
+            {
+              jac[k][j] = dxds[k][j][ipt];
+            }
+          }
+          const double det =
+            jac[0][0] * jac[1][1] * jac[2][2] +
+            jac[0][1] * jac[1][2] * jac[2][0] +
+            jac[0][2] * jac[1][0] * jac[2][1] -
+            jac[0][0] * jac[1][2] * jac[2][1] -
+            jac[0][1] * jac[1][0] * jac[2][2] -
+            jac[0][2] * jac[1][1] * jac[2][0];
+          W[ipt] = SumFactorisation::Weight[q0] *
+                   SumFactorisation::Weight[q1] *
+                   SumFactorisation::Weight[q2] * det;
+        }
+      }
+    }
+
+    unsigned u_nodal_index[5];
+    for (unsigned i = 0; i < n_flux; i++)
+    {
+      u_nodal_index[i] = this->u_index_flux_transport(i);
+    }
+
+    // Loop over the columns
+    double knot_values[Nintpt_1d * Nintpt_1d * Nintpt_1d];
+    double column[NNODE_1D * NNODE_1D * NNODE_1D];
+    for (unsigned l2 = 0; l2 < n_node; l2++)
+    {
+      // Local indices of the node in each coordinate direction
+      const unsigned l2_0 = l2 % NNODE_1D;
+      const unsigned l2_1 = (l2 / NNODE_1D) % NNODE_1D;
+      const unsigned l2_2 = l2 / (NNODE_1D * NNODE_1D);
+
+      // Weighted shape function at the knots
+      for (unsigned q2 = 0, ipt = 0; q2 < Nintpt_1d; q2++)
+      {
+        for (unsigned q1 = 0; q1 < Nintpt_1d; q1++)
+        {
+          const double psi_21 =
+            psi[NNODE_1D * q2 + l2_2] * psi[NNODE_1D * q1 + l2_1];
+          for (unsigned q0 = 0; q0 < Nintpt_1d; q0++, ipt++)
+          {
+            knot_values[ipt] = psi_21 * psi[NNODE_1D * q0 + l2_0] * W[ipt];
+          }
+        }
+      }
+
+      // Integrate against the test functions
+      for (unsigned l = 0; l < n_node; l++)
+      {
+        column[l] = 0.0;
+      }
+      SumFactorisation::add_integral_over_knots(
+        a_interpolate, knot_values, column);
+
+      // Add to the mass matrix block of each unknown
+      for (unsigned i = 0; i < n_flux; i++)
+      {
+        const int local_unknown = this->nodal_local_eqn(l2, u_nodal_index[i]);
+        if (local_unknown >= 0)
+        {
+          for (unsigned l = 0; l < n_node; l++)
+          {
+            const int local_eqn = this->nodal_local_eqn(l, u_nodal_index[i]);
+            if (local_eqn >= 0)
+            {
+              mass_matrix(local_eqn, local_unknown) += column[l];
+            }
+          }
+        }
+      }
+    }
+  }
+
+
+  template class DGSpectralEulerElement<3, 2>;
+  template class DGSpectralEulerElement<3, 3>;
+  template class DGSpectralEulerElement<3, 4>;
+
 } // namespace oomph
@@ -377,7 +377,8 @@ namespace oomph
 
     // Loop over the test functions and derivatives and set them equal to the
     // shape functions
-    for (unsigned i = 0; i < NNODE_1D; i++)
+    const unsigned n_node = this->nnode();
+    for (unsigned i = 0; i < n_node; i++)
     {
       test[i] = psi[i];
       for (unsigned j = 0; j < DIM; j++)
@@ -509,35 +510,36 @@ namespace oomph
 
       const double gamma = cast_bulk_element_pt->gamma();
 
-      // Now let's find the fluxes
-      DenseMatrix<double> flux_int(n_flux, dim);
-      DenseMatrix<double> flux_ext(n_flux, dim);
-
-      cast_bulk_element_pt->flux(u_int, flux_int);
-      cast_bulk_element_pt->flux(u_ext, flux_ext);
+      // The normal fluxes are assembled directly from the pressures and
+      // the normal velocities, rather than from the full flux matrices,
+      // so that nothing needs to be allocated at every knot. There are
+      // at most three velocity components (and five fluxes).
+      double p_int = cast_bulk_element_pt->pressure(u_int);
+      double p_ext = cast_bulk_element_pt->pressure(u_ext);
 
-      DenseMatrix<double> flux_av(n_flux, dim);
-      for (unsigned i = 0; i < n_flux; i++)
+      double vel_int[3], vel_ext[3];
+      double vn_int = 0.0, vn_ext = 0.0;
+      for (unsigned j = 0; j < dim; j++)
       {
-        for (unsigned j = 0; j < dim; j++)
-        {
-          flux_av(i, j) = 0.5 * (flux_int(i, j) + flux_ext(i, j));
-        }
+        vel_int[j] = u_int[2 + j] / u_int[0];
+        vel_ext[j] = u_ext[2 + j] / u_ext[0];
+        vn_int += vel_int[j] * n_out[j];
+        vn_ext += vel_ext[j] * n_out[j];
       }
 
-      flux.initialise(0.0);
-      // Now set the first part of the numerical flux
-      for (unsigned i = 0; i < n_flux; i++)
+      // Now set the first part of the numerical flux: the average of the
+      // internal and external fluxes dotted with the normal
+      flux[0] = 0.5 * (u_int[0] * vn_int + u_ext[0] * vn_ext);
+      flux[1] =
+        0.5 * ((u_int[1] + p_int) * vn_int + (u_ext[1] + p_ext) * vn_ext);
+      for (unsigned j = 0; j < dim; j++)
       {
-        for (unsigned j = 0; j < dim; j++)
-        {
-          flux[i] += flux_av(i, j) * n_out[j];
-        }
+        flux[2 + j] = 0.5 * (u_int[2 + j] * vn_int + u_ext[2 + j] * vn_ext +
+                             (p_int + p_ext) * n_out[j]);
       }
 
       // Now let's find the normal jumps in the fluxes
-      Vector<double> jump(n_flux);
-      // Now we take the normal jump in the quantities
+      double jump[5];
       // The first two are scalars
       for (unsigned i = 0; i < 2; i++)
       {
@@ -557,34 +559,6 @@ namespace oomph
         jump[2 + j] = velocity_jump * n_out[j];
       }
 
-
-      // Let's find the Roe average
-      /*   Vector<double> u_average(n_flux);
-      double sum = sqrt(u_int[0]) + sqrt(u_ext[0]);
-      for(unsigned i=0;i<n_flux;i++)
-       {
-        u_average[i] = (sqrt(u_int[0])*u_int[i] + sqrt(u_ext[0])*u_ext[i])/sum;
-       }
-
-      //Find the average pressure
-      double p = cast_bulk_element_pt->pressure(u_average);
-
-      //Now do the normal velocity
-      double vel = 0.0;
-      for(unsigned j=0;j<dim;j++)
-       {
-        //vel += u_average[2+j]*u_average[2+j];
-        vel += u_average[2+j]*n_out[j];
-       }
-      //vel = sqrt(vel)/u_average[0];
-      vel /= u_average[0];
-
-      double arg = std::fabs(gamma*p/u_average[0]);*/
-
-      // Let's calculate the internal and external pressures and then enthalpies
-      double p_int = cast_bulk_element_pt->pressure(u_int);
-      double p_ext = cast_bulk_element_pt->pressure(u_ext);
-
       // Limit the pressures to zero if necessary, but keep the energy the
       // same
       if (p_int < 0)
@@ -598,19 +572,12 @@ namespace oomph
         p_ext = 0.0;
       }
 
+      // Calculate the internal and external enthalpies
       double H_int = (u_int[1] + p_int) / u_int[0];
       double H_ext = (u_ext[1] + p_ext) / u_ext[0];
 
-      // Also calculate the velocities
-      Vector<double> vel_int(2), vel_ext(2);
-      for (unsigned j = 0; j < dim; j++)
-      {
-        vel_int[j] = u_int[2 + j] / u_int[0];
-        vel_ext[j] = u_ext[2 + j] / u_ext[0];
-      }
-
       // Now we calculate the Roe averaged values
-      Vector<double> vel_average(dim);
+      double vel_average[3];
       double s_int = sqrt(u_int[0]);
       double s_ext = sqrt(u_ext[0]);
       double sum = s_int + s_ext;
@@ -628,7 +595,7 @@ namespace oomph
       double arg = H_average;
       for (unsigned j = 0; j < dim; j++)
       {
-        arg -= 0.5 * vel_average[j];
+        arg -= 0.5 * vel_average[j] * vel_average[j];
       }
       arg *= (gamma - 1.0);
       // Get the local sound speed
@@ -640,50 +607,14 @@ namespace oomph
       double a = sqrt(arg);
 
       // Calculate the normal average velocity
-      // Now do the normal velocity
       double vel = 0.0;
       for (unsigned j = 0; j < dim; j++)
       {
         vel += vel_average[j] * n_out[j];
       }
 
-      Vector<double> eigA(3, 0.0);
-
-      eigA[0] = vel - a;
-      eigA[1] = vel;
-      eigA[2] = vel + a;
-
-      double lambda = std::fabs(eigA[0]);
-      for (unsigned i = 1; i < 3; i++)
-      {
-        if (std::fabs(eigA[i]) > lambda)
-        {
-          lambda = std::fabs(eigA[i]);
-        }
-      }
-
-
-      // Find the magnitude of the external velocity
-      /*double vel_mag = 0.0;
-      for(unsigned j=0;j<dim;j++) {vel_mag += u_ext[2+j]*u_ext[2+j];}
-      vel_mag = sqrt(vel_mag)/u_ext[0];
-
-      //Get the pressure
-      double p = cast_bulk_element_pt->pressure(u_ext);
-      double lambda_ext = vel_mag + sqrt(std::fabs(gamma*p/u_ext[0]));
-
-      //Let's do the same for the internal one
-      vel_mag = 0.0;
-      for(unsigned j=0;j<dim;j++) {vel_mag += u_int[2+j]*u_int[2+j];}
-      vel_mag = sqrt(vel_mag)/u_int[0];
-
-      //Get the pressure
-      p = cast_bulk_element_pt->pressure(u_int);
-      double lambda_int = vel_mag + sqrt(std::fabs(gamma*p/u_int[0]));
-
-      //Now take the largest
-      double lambda = lambda_int;
-      if(lambda_ext > lambda) {lambda = lambda_ext;}*/
+      // The largest of the eigenvalues vel-a, vel and vel+a in magnitude
+      double lambda = std::fabs(vel) + a;
 
       for (unsigned i = 0; i < n_flux; i++)
       {
@@ -983,6 +914,137 @@ namespace oomph
   };
 
 
+  //==================================================================
+  /// \short Specialisation for 3D DG Elements. The residuals and the
+  /// mass matrix (which are all that is required by the explicit
+  /// timesteppers) are computed by sum-factorised volume kernels that
+  /// exploit the tensor-product structure of the shape functions and of
+  /// the default integration scheme; everything else (the Jacobian and
+  /// non-default integration schemes) uses the generic code.
+  /// DGElement::get_inverse_mass_matrix_times_residuals() reaches the
+  /// kernels both when the mass matrix is (re-)assembled (flag=3) and
+  /// when it is reused (flag=0).
+  //==================================================================
+  template<unsigned NNODE_1D>
+  class DGSpectralEulerElement<3, NNODE_1D>
+    : public QSpectralEulerElement<3, NNODE_1D>, public DGElement
+  {
+    friend class DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>;
+
+    /// \short Number of integration points in each coordinate direction
+    /// of the default integration scheme
+    static const unsigned Nintpt_1d = 3 * NNODE_1D / 2;
+
+    /// \short Default (volume) integration scheme: over-integrate to
+    /// resolve the quadratic non-linearities
+    static GaussLobattoLegendre<3, Nintpt_1d> Default_integration_scheme;
+
+    static Gauss<2, NNODE_1D> Default_face_integration_scheme;
+
+    /// \short Sum-factorisation kernels and one-dimensional matrices for
+    /// the default integration scheme
+    typedef SpectralSumFactorisation<3, NNODE_1D, Nintpt_1d> SumFactorisation;
+
+    /// \short Add the volume contributions to the residuals by sum
+    /// factorisation (equivalent to the generic version with flag=0)
+    void fill_in_residuals_by_sum_factorisation(Vector<double>& residuals);
+
+    /// \short Add the mass matrix by sum factorisation (equivalent to the
+    /// mass matrix computed by the generic version with flag=3)
+    void fill_in_mass_matrix_by_sum_factorisation(
+      DenseMatrix<double>& mass_matrix);
+
+  public:
+    /// Overload the required number of fluxes for the DGElement
+    unsigned required_nflux()
+    {
+      return this->nflux();
+    }
+
+    // Calculate averages
+    void calculate_element_averages(double*& average_value)
+    {
+      FluxTransportEquations<3>::calculate_element_averages(average_value);
+    }
+
+    // Constructor
+    DGSpectralEulerElement() : QSpectralEulerElement<3, NNODE_1D>(), DGElement()
+    {
+      // Need to up the order of integration for the accurate resolution
+      // of the quadratic non-linearities
+      this->set_integration_scheme(&Default_integration_scheme);
+      SumFactorisation::calculate_one_d_matrices();
+    }
+
+    ~DGSpectralEulerElement() {}
+
+    Integral* face_integration_pt() const
+    {
+      return &Default_face_integration_scheme;
+    }
+
+    void build_all_faces()
+    {
+      Face_element_pt.resize(6);
+      Face_element_pt[0] =
+        new DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>(this, 3);
+      Face_element_pt[1] =
+        new DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>(this, 2);
+      Face_element_pt[2] =
+        new DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>(this, 1);
+      Face_element_pt[3] =
+        new DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>(this, -3);
+      Face_element_pt[4] =
+        new DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>(this, -2);
+      Face_element_pt[5] =
+        new DGEulerFaceElement<DGSpectralEulerElement<3, NNODE_1D>>(this, -1);
+    }
+
+
+    ///\short Compute the residuals for the Euler equations;
+    /// flag=1(or 0): do (or don't) compute the Jacobian as well;
+    /// flag=2 (or 3): also compute the mass matrix (without the Jacobian).
+    /// The residuals and, for flag=3, the mass matrix are computed by sum
+    /// factorisation, provided that the default integration scheme is used.
+    void fill_in_generic_residual_contribution_flux_transport(
+      Vector<double>& residuals,
+      DenseMatrix<double>& jacobian,
+      DenseMatrix<double>& mass_matrix,
+      unsigned flag)
+    {
+      if (((flag == 0) || (flag == 3)) &&
+          (this->integral_pt() == &Default_integration_scheme))
+      {
+        fill_in_residuals_by_sum_factorisation(residuals);
+        if (flag == 3)
+        {
+          fill_in_mass_matrix_by_sum_factorisation(mass_matrix);
+        }
+      }
+      else
+      {
+        QSpectralEulerElement<3, NNODE_1D>::
+          fill_in_generic_residual_contribution_flux_transport(
+            residuals, jacobian, mass_matrix, flag);
+      }
+
+      this->add_flux_contributions_to_residuals(residuals, jacobian, flag);
+    }
+  };
+
+
+  //=======================================================================
+  /// Face geometry of the 3D DG elements
+  //=======================================================================
+  template<unsigned NNODE_1D>
+  class FaceGeometry<DGSpectralEulerElement<3, NNODE_1D>>
+    : public virtual QSpectralElement<2, NNODE_1D>
+  {
+  public:
+    FaceGeometry() : QSpectralElement<2, NNODE_1D>() {}
+  };
+
+
 } // namespace oomph
 
 #endif
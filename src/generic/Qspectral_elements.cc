@@ -31,6 +31,9 @@ namespace oomph
 {
   std::map<unsigned, Vector<double>> OneDLegendreShapeParam::z;
 
+  std::map<unsigned, Vector<double>>
+    OneDLegendreShapeParam::Legendre_at_nodes;
+
 
   //////////////////////////////////////////////////////////////////////////
   ///                   1D QLegendreElements
@@ -47,6 +47,11 @@ namespace oomph
   public:
     static std::map<unsigned, Vector<double>> z;
 
+    /// \short Legendre polynomial of degree order-1 evaluated at the
+    /// nodes z[order], indexed by the order (stored to avoid re-computing
+    /// it for every evaluation of the shape functions and their derivatives)
+    static std::map<unsigned, Vector<double>> Legendre_at_nodes;
+
     /// Static function used to populate the stored positions
     static inline void calculate_nodal_positions(const unsigned& order)
     {
@@ -54,6 +59,12 @@ namespace oomph
       if (z.find(order) == z.end())
       {
         Orthpoly::gll_nodes(order, z[order]);
+        Vector<double>& legendre_at_z = Legendre_at_nodes[order];
+        legendre_at_z.resize(order);
+        for (unsigned i = 0; i < order; i++)
+        {
+          legendre_at_z[i] = Orthpoly::legendre(order - 1, z[order][i]);
+        }
       }
     }
 
@@ -70,11 +81,20 @@ namespace oomph
       using namespace Orthpoly;
 
       unsigned p = order - 1;
+
+      // Look up the nodes and the stored Legendre values once
+      const Vector<double>& z_order = z[order];
+      const Vector<double>& legendre_at_z = Legendre_at_nodes[order];
+
+      // The parts that don't depend on the node only have to be computed
+      // once
+      const double numerator = (1.0 - s * s) * dlegendre(p, s);
+
       // Now populate the shape function
       for (unsigned i = 0; i < order; i++)
       {
         // If we're at one of the nodes, the value must be 1.0
-        if (std::fabs(s - z[order][i]) < Orthpoly::eps)
+        if (std::fabs(s - z_order[i]) < Orthpoly::eps)
         {
           (*this)[i] = 1.0;
         }
@@ -82,8 +102,7 @@ namespace oomph
         else
         {
           (*this)[i] =
-            (1.0 - s * s) * dlegendre(p, s) /
-            (p * (p + 1) * legendre(p, z[order][i]) * (z[order][i] - s));
+            numerator / (p * (p + 1) * legendre_at_z[i] * (z_order[i] - s));
         }
       }
     }
@@ -98,22 +117,27 @@ namespace oomph
       : Shape(order)
     {
       unsigned p = order - 1;
-      Vector<double> z = OneDLegendreShapeParam::z[order];
+      const Vector<double>& z = OneDLegendreShapeParam::z[order];
+      const Vector<double>& legendre_at_z =
+        OneDLegendreShapeParam::Legendre_at_nodes[order];
 
+      // Check if s happens to be a root (this doesn't depend on
+      // the shape function so only needs to be done once)
       bool root = false;
-      for (unsigned i = 0; i < order; i++)
+      unsigned rootnum = 0;
+      for (unsigned j = 0; j < order; j++)
       {
-        unsigned rootnum = 0;
-        for (unsigned j = 0; j < order; j++)
-        { // Loop over roots to check if
-          if (std::fabs(s - z[j]) < 10.0 * Orthpoly::eps)
-          { // s happens to be a root.
-            root = true;
-            break;
-          }
-          rootnum += 1;
+        if (std::fabs(s - z[j]) < 10.0 * Orthpoly::eps)
+        {
+          root = true;
+          break;
         }
-        if (root == true)
+        rootnum += 1;
+      }
+
+      if (root == true)
+      {
+        for (unsigned i = 0; i < order; i++)
         {
           if (i == rootnum && i == 0)
           {
@@ -129,18 +153,23 @@ namespace oomph
           }
           else
           {
-            (*this)[i] = Orthpoly::legendre(p, z[rootnum]) /
-                         Orthpoly::legendre(p, z[i]) / (z[rootnum] - z[i]);
+            (*this)[i] =
+              legendre_at_z[rootnum] / legendre_at_z[i] / (z[rootnum] - z[i]);
           }
         }
-        else
+      }
+      else
+      {
+        // Legendre polynomial derivatives at s are the same for all
+        // shape functions
+        const double dlegendre_s = Orthpoly::dlegendre(p, s);
+        const double ddlegendre_s = Orthpoly::ddlegendre(p, s);
+        for (unsigned i = 0; i < order; i++)
         {
-          (*this)[i] =
-            ((1 + s * (s - 2 * z[i])) / (s - z[i]) * Orthpoly::dlegendre(p, s) -
-             (1 - s * s) * Orthpoly::ddlegendre(p, s)) /
-            p / (p + 1.0) / Orthpoly::legendre(p, z[i]) / (s - z[i]);
+          (*this)[i] = ((1 + s * (s - 2 * z[i])) / (s - z[i]) * dlegendre_s -
+                        (1 - s * s) * ddlegendre_s) /
+                       p / (p + 1.0) / legendre_at_z[i] / (s - z[i]);
         }
-        root = false;
       }
     }
   };
@@ -1314,6 +1343,393 @@ namespace oomph
     /*   } */
   }
 
+  //=======================================================================
+  /// \short One-dimensional matrices used to evaluate tensor-product
+  /// spectral interpolants by sum factorisation: the NNODE_1D
+  /// one-dimensional Legendre shape functions and their derivatives at
+  /// the NKNOT_1D Gauss-Lobatto-Legendre knots (whose tensor product is
+  /// GaussLobattoLegendre<DIM,NKNOT_1D>) and the associated weights.
+  //=======================================================================
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  class OneDimensionalSumFactorisationMatrices
+  {
+  public:
+    /// \short One-dimensional shape functions at the one-dimensional
+    /// knots: Psi[NNODE_1D*q+l] = psi_l(s_q)
+    static Vector<double> Psi;
+
+    /// \short Derivatives of the one-dimensional shape functions at the
+    /// one-dimensional knots: Dpsi[NNODE_1D*q+l] = dpsi_l/ds(s_q)
+    static Vector<double> Dpsi;
+
+    /// Weights of the one-dimensional integration scheme
+    static Vector<double> Weight;
+
+    /// Set up the one-dimensional matrices (only once)
+    static void calculate_one_d_matrices()
+    {
+      if (One_d_matrices_calculated)
+      {
+        return;
+      }
+
+      // The shape functions need the nodal positions
+      OneDimensionalLegendreShape<NNODE_1D>::calculate_nodal_positions();
+
+      // Get the one-dimensional knots and weights
+      Vector<double> s(NKNOT_1D);
+      Weight.resize(NKNOT_1D);
+      Orthpoly::gll_nodes(NKNOT_1D, s, Weight);
+
+      Psi.resize(NKNOT_1D * NNODE_1D);
+      Dpsi.resize(NKNOT_1D * NNODE_1D);
+      for (unsigned q = 0; q < NKNOT_1D; q++)
+      {
+        OneDimensionalLegendreShape<NNODE_1D> psi(s[q]);
+        OneDimensionalLegendreDShape<NNODE_1D> dpsids(s[q]);
+        for (unsigned l = 0; l < NNODE_1D; l++)
+        {
+          Psi[NNODE_1D * q + l] = psi[l];
+          Dpsi[NNODE_1D * q + l] = dpsids[l];
+        }
+      }
+
+      One_d_matrices_calculated = true;
+    }
+
+  private:
+    /// Flag to indicate whether the one-dimensional matrices have been set up
+    static bool One_d_matrices_calculated;
+  };
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  Vector<double>
+    OneDimensionalSumFactorisationMatrices<NNODE_1D, NKNOT_1D>::Psi;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  Vector<double>
+    OneDimensionalSumFactorisationMatrices<NNODE_1D, NKNOT_1D>::Dpsi;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  Vector<double>
+    OneDimensionalSumFactorisationMatrices<NNODE_1D, NKNOT_1D>::Weight;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  bool OneDimensionalSumFactorisationMatrices<
+    NNODE_1D,
+    NKNOT_1D>::One_d_matrices_calculated = false;
+
+
+  //=======================================================================
+  /// \short Sum-factorisation kernels for DIM-dimensional tensor-product
+  /// spectral elements: interpolate the NNODE_1D^DIM nodal values to the
+  /// NKNOT_1D^DIM knots (and integrate against the test functions) one
+  /// coordinate direction at a time, which costs O(p^(DIM+1)) rather
+  /// than the O(p^(2 DIM)) of point-by-point evaluation. The first index
+  /// varies fastest in both the nodal and the knot numbering, as in
+  /// QSpectralElement and GaussLobattoLegendre.
+  //=======================================================================
+  template<unsigned DIM, unsigned NNODE_1D, unsigned NKNOT_1D>
+  class SpectralSumFactorisation;
+
+
+  //=======================================================================
+  /// Sum-factorisation kernels for one-dimensional spectral elements
+  //=======================================================================
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  class SpectralSumFactorisation<1, NNODE_1D, NKNOT_1D>
+    : public OneDimensionalSumFactorisationMatrices<NNODE_1D, NKNOT_1D>
+  {
+  public:
+    /// Number of nodes
+    static const unsigned Nnode = NNODE_1D;
+
+    /// Number of knots
+    static const unsigned Nknot = NKNOT_1D;
+
+    /// \short Interpolate the nodal values to the knots, applying the
+    /// one-dimensional matrix a[0] (Psi or Dpsi)
+    static void interpolate_to_knots(const double* const* a,
+                                     const double* const& nodal_values,
+                                     double* const& knot_values)
+    {
+      for (unsigned q0 = 0; q0 < NKNOT_1D; q0++)
+      {
+        double sum = 0.0;
+        for (unsigned l0 = 0; l0 < NNODE_1D; l0++)
+        {
+          sum += a[0][NNODE_1D * q0 + l0] * nodal_values[l0];
+        }
+        knot_values[q0] = sum;
+      }
+    }
+
+    /// \short Add the transpose of interpolate_to_knots(...) applied to
+    /// knot_values to nodal_values, i.e. integrate against the test
+    /// functions (or their local derivatives)
+    static void add_integral_over_knots(const double* const* a,
+                                        const double* const& knot_values,
+                                        double* const& nodal_values)
+    {
+      for (unsigned l0 = 0; l0 < NNODE_1D; l0++)
+      {
+        double sum = 0.0;
+        for (unsigned q0 = 0; q0 < NKNOT_1D; q0++)
+        {
+          sum += a[0][NNODE_1D * q0 + l0] * knot_values[q0];
+        }
+        nodal_values[l0] += sum;
+      }
+    }
+  };
+
+
+  //=======================================================================
+  /// Sum-factorisation kernels for two-dimensional spectral elements
+  //=======================================================================
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  class SpectralSumFactorisation<2, NNODE_1D, NKNOT_1D>
+    : public OneDimensionalSumFactorisationMatrices<NNODE_1D, NKNOT_1D>
+  {
+  public:
+    /// Number of nodes
+    static const unsigned Nnode = NNODE_1D * NNODE_1D;
+
+    /// Number of knots
+    static const unsigned Nknot = NKNOT_1D * NKNOT_1D;
+
+    /// \short Interpolate the nodal values to the knots, applying the
+    /// one-dimensional matrix a[k] (Psi or Dpsi) in the k-th coordinate
+    /// direction
+    static void interpolate_to_knots(const double* const* a,
+                                     const double* const& nodal_values,
+                                     double* const& knot_values)
+    {
+      const unsigned n = NNODE_1D;
+      const unsigned q = NKNOT_1D;
+
+      // Contract over the first index: t1[l1*q + q0]
+      double t1[NNODE_1D * NKNOT_1D];
+      for (unsigned l1 = 0; l1 < n; l1++)
+      {
+        for (unsigned q0 = 0; q0 < q; q0++)
+        {
+          double sum = 0.0;
+          for (unsigned l0 = 0; l0 < n; l0++)
+          {
+            sum += a[0][n * q0 + l0] * nodal_values[n * l1 + l0];
+          }
+          t1[q * l1 + q0] = sum;
+        }
+      }
+
+      // Contract over the second index
+      for (unsigned q1 = 0; q1 < q; q1++)
+      {
+        for (unsigned q0 = 0; q0 < q; q0++)
+        {
+          double sum = 0.0;
+          for (unsigned l1 = 0; l1 < n; l1++)
+          {
+            sum += a[1][n * q1 + l1] * t1[q * l1 + q0];
+          }
+          knot_values[q * q1 + q0] = sum;
+        }
+      }
+    }
+
+    /// \short Add the transpose of interpolate_to_knots(...) applied to
+    /// knot_values to nodal_values, i.e. integrate against the test
+    /// functions (or their local derivatives)
+    static void add_integral_over_knots(const double* const* a,
+                                        const double* const& knot_values,
+                                        double* const& nodal_values)
+    {
+      const unsigned n = NNODE_1D;
+      const unsigned q = NKNOT_1D;
+
+      // Contract over the second index: t1[l1*q + q0]
+      double t1[NNODE_1D * NKNOT_1D];
+      for (unsigned l1 = 0; l1 < n; l1++)
+      {
+        for (unsigned q0 = 0; q0 < q; q0++)
+        {
+          double sum = 0.0;
+          for (unsigned q1 = 0; q1 < q; q1++)
+          {
+            sum += a[1][n * q1 + l1] * knot_values[q * q1 + q0];
+          }
+          t1[q * l1 + q0] = sum;
+        }
+      }
+
+      // Contract over the first index
+      for (unsigned l1 = 0; l1 < n; l1++)
+      {
+        for (unsigned l0 = 0; l0 < n; l0++)
+        {
+          double sum = 0.0;
+          for (unsigned q0 = 0; q0 < q; q0++)
+          {
+            sum += a[0][n * q0 + l0] * t1[q * l1 + q0];
+          }
+          nodal_values[n * l1 + l0] += sum;
+        }
+      }
+    }
+  };
+
+
+  //=======================================================================
+  /// Sum-factorisation kernels for three-dimensional spectral elements
+  //=======================================================================
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  class SpectralSumFactorisation<3, NNODE_1D, NKNOT_1D>
+    : public OneDimensionalSumFactorisationMatrices<NNODE_1D, NKNOT_1D>
+  {
+  public:
+    /// Number of nodes
+    static const unsigned Nnode = NNODE_1D * NNODE_1D * NNODE_1D;
+
+    /// Number of knots
+    static const unsigned Nknot = NKNOT_1D * NKNOT_1D * NKNOT_1D;
+
+    /// \short Interpolate the nodal values to the knots, applying the
+    /// one-dimensional matrix a[k] (Psi or Dpsi) in the k-th coordinate
+    /// direction
+    static void interpolate_to_knots(const double* const* a,
+                                     const double* const& nodal_values,
+                                     double* const& knot_values)
+    {
+      const unsigned n = NNODE_1D;
+      const unsigned q = NKNOT_1D;
+
+      // Contract over the first index: t1[(l2*n + l1)*q + q0]
+      double t1[NNODE_1D * NNODE_1D * NKNOT_1D];
+      for (unsigned l21 = 0; l21 < n * n; l21++)
+      {
+        for (unsigned q0 = 0; q0 < q; q0++)
+        {
+          double sum = 0.0;
+          for (unsigned l0 = 0; l0 < n; l0++)
+          {
+            sum += a[0][n * q0 + l0] * nodal_values[n * l21 + l0];
+          }
+          t1[q * l21 + q0] = sum;
+        }
+      }
+
+      // Contract over the second index: t2[(l2*q + q1)*q + q0]
+      double t2[NNODE_1D * NKNOT_1D * NKNOT_1D];
+      for (unsigned l2 = 0; l2 < n; l2++)
+      {
+        for (unsigned q1 = 0; q1 < q; q1++)
+        {
+          for (unsigned q0 = 0; q0 < q; q0++)
+          {
+            double sum = 0.0;
+            for (unsigned l1 = 0; l1 < n; l1++)
+            {
+              sum += a[1][n * q1 + l1] * t1[q * (n * l2 + l1) + q0];
+            }
+            t2[q * (q * l2 + q1) + q0] = sum;
+          }
+        }
+      }
+
+      // Contract over the third index
+      for (unsigned q2 = 0; q2 < q; q2++)
+      {
+        for (unsigned q10 = 0; q10 < q * q; q10++)
+        {
+          double sum = 0.0;
+          for (unsigned l2 = 0; l2 < n; l2++)
+          {
+            sum += a[2][n * q2 + l2] * t2[q * q * l2 + q10];
+          }
+          knot_values[q * q * q2 + q10] = sum;
+        }
+      }
+    }
+
+    /// \short Add the transpose of interpolate_to_knots(...) applied to
+    /// knot_values to nodal_values, i.e. integrate against the test
+    /// functions (or their local derivatives)
+    static void add_integral_over_knots(const double* const* a,
+                                        const double* const& knot_values,
+                                        double* const& nodal_values)
+    {
+      const unsigned n = NNODE_1D;
+      const unsigned q = NKNOT_1D;
+
+      // Contract over the third index: t2[(l2*q + q1)*q + q0]
+      double t2[NNODE_1D * NKNOT_1D * NKNOT_1D];
+      for (unsigned l2 = 0; l2 < n; l2++)
+      {
+        for (unsigned q10 = 0; q10 < q * q; q10++)
+        {
+          double sum = 0.0;
+          for (unsigned q2 = 0; q2 < q; q2++)
+          {
+            sum += a[2][n * q2 + l2] * knot_values[q * q * q2 + q10];
+          }
+          t2[q * q * l2 + q10] = sum;
+        }
+      }
+
+      // Contract over the second index: t1[(l2*n + l1)*q + q0]
+      double t1[NNODE_1D * NNODE_1D * NKNOT_1D];
+      for (unsigned l2 = 0; l2 < n; l2++)
+      {
+        for (unsigned l1 = 0; l1 < n; l1++)
+        {
+          for (unsigned q0 = 0; q0 < q; q0++)
+          {
+            double sum = 0.0;
+            for (unsigned q1 = 0; q1 < q; q1++)
+            {
+              sum += a[1][n * q1 + l1] * t2[q * (q * l2 + q1) + q0];
+            }
+            t1[q * (n * l2 + l1) + q0] = sum;
+          }
+        }
+      }
+
+      // Contract over the first index
+      for (unsigned l21 = 0; l21 < n * n; l21++)
+      {
+        for (unsigned l0 = 0; l0 < n; l0++)
+        {
+          double sum = 0.0;
+          for (unsigned q0 = 0; q0 < q; q0++)
+          {
+            sum += a[0][n * q0 + l0] * t1[q * l21 + q0];
+          }
+          nodal_values[n * l21 + l0] += sum;
+        }
+      }
+    }
+  };
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  const unsigned SpectralSumFactorisation<1, NNODE_1D, NKNOT_1D>::Nnode;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  const unsigned SpectralSumFactorisation<1, NNODE_1D, NKNOT_1D>::Nknot;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  const unsigned SpectralSumFactorisation<2, NNODE_1D, NKNOT_1D>::Nnode;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  const unsigned SpectralSumFactorisation<2, NNODE_1D, NKNOT_1D>::Nknot;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  const unsigned SpectralSumFactorisation<3, NNODE_1D, NKNOT_1D>::Nnode;
+
+  template<unsigned NNODE_1D, unsigned NKNOT_1D>
+  const unsigned SpectralSumFactorisation<3, NNODE_1D, NKNOT_1D>::Nknot;
+
+
   //==============================================================
   /// A class that is used to template the refineable Q spectral elements
   /// by dimension. It's really nothing more than a policy class
@@ -4250,7 +4250,7 @@ namespace oomph
     // the dof types.
 
     // Get the most fine grain block to dof mapping.
-    Vector<unsigned> most_fine_grain_dof = Block_to_dof_map_fine[b];
+    const Vector<unsigned>& most_fine_grain_dof = Block_to_dof_map_fine[b];
 
     // How many vectors do we need to concatenate?
     const unsigned n_dof_vec = most_fine_grain_dof.size();
@@ -4531,7 +4531,7 @@ namespace oomph
 #endif
 
     // Get the most fine grain dof
-    Vector<unsigned> most_fine_grain_dof = Block_to_dof_map_fine[n];
+    const Vector<unsigned>& most_fine_grain_dof = Block_to_dof_map_fine[n];
 
     // How many dofs are in this block?
     const unsigned n_dof_vec = Block_to_dof_map_fine[n].size();
@@ -1190,13 +1190,19 @@ namespace oomph
     }
     for (unsigned long i = 0; i < N; i++)
     {
-      soln[i] = 0.0;
+      // Accumulate the real and imaginary parts separately: plain real
+      // arithmetic avoids the (IEEE-compliant but slow) library call
+      // behind the product of two std::complex<double>s
+      double sum_real = 0.0;
+      double sum_imag = 0.0;
       for (long k = Row_start[i]; k < Row_start[i + 1]; k++)
       {
-        unsigned long j = Column_index[k];
-        std::complex<double> a_ij = Value[k];
-        soln[i] += a_ij * x[j];
+        const std::complex<double>& a_ij = Value[k];
+        const std::complex<double>& x_j = x[Column_index[k]];
+        sum_real += a_ij.real() * x_j.real() - a_ij.imag() * x_j.imag();
+        sum_imag += a_ij.real() * x_j.imag() + a_ij.imag() * x_j.real();
       }
+      soln[i] = std::complex<double>(sum_real, sum_imag);
     }
   }
 
@@ -1236,11 +1242,15 @@ namespace oomph
     // Matrix vector product
     for (unsigned long i = 0; i < N; i++)
     {
+      const double x_real = x[i].real();
+      const double x_imag = x[i].imag();
       for (long k = Row_start[i]; k < Row_start[i + 1]; k++)
       {
         unsigned long j = Column_index[k];
-        std::complex<double> a_ij = Value[k];
-        soln[j] += a_ij * x[i];
+        const std::complex<double>& a_ij = Value[k];
+        soln[j] += std::complex<double>(
+          a_ij.real() * x_real - a_ij.imag() * x_imag,
+          a_ij.real() * x_imag + a_ij.imag() * x_real);
       }
     }
   }
@@ -29,6 +29,8 @@
 #include "dg_elements.h"
 #include "shape.h"
 #include <iomanip>
+#include <map>
+#include <typeinfo>
 
 namespace oomph
 {
@@ -573,38 +575,369 @@ namespace oomph
   }
 
   //========================================================================
-  ///\short Function that computes and stores the (inverse) mass matrix
+  /// Detect the structure of the assembled mass matrix of element_pt and
+  /// store the inverse of its irreducible part. If the values stored
+  /// at the nodes are uncoupled and all share the same block of the mass
+  /// matrix, only (the inverse of) that block is stored.
   //========================================================================
-  void DGElement::pre_compute_mass_matrix()
+  void DGMassMatrix::factorise(DGElement* const& element_pt,
+                               const DenseMatrix<double>& mass_matrix)
   {
-    // Now let's assemble stuff
-    const unsigned n_dof = this->ndof();
-    // Allocate storage for the local mass matrix (if required)
-    if (M_pt == 0)
+    // Tolerance (relative to the largest entry) used to decide whether
+    // entries of the mass matrix are equal or zero
+    const double tol = 1.0e-12;
+
+    const unsigned n_dof = mass_matrix.nrow();
+    const unsigned n_node = element_pt->nnode();
+
+    // Find the largest entry in the mass matrix
+    double max_entry = 0.0;
+    for (unsigned i = 0; i < n_dof; i++)
     {
-      M_pt = new DenseDoubleMatrix;
+      for (unsigned j = 0; j < n_dof; j++)
+      {
+        max_entry = std::max(max_entry, std::fabs(mass_matrix(i, j)));
+      }
     }
+    const double zero = tol * max_entry;
+
+    // The block structure can only be used if every dof is a value stored
+    // at a node and all nodes store the same number of values
+    Nvalue = 0;
+    if (n_node > 0)
+    {
+      Nvalue = element_pt->node_pt(0)->nvalue();
+    }
+    if (n_node * Nvalue != n_dof)
+    {
+      Nvalue = 0;
+    }
+    for (unsigned n = 0; (n < n_node) && (Nvalue > 0); n++)
+    {
+      if (element_pt->node_pt(n)->nvalue() != Nvalue)
+      {
+        Nvalue = 0;
+        break;
+      }
+      for (unsigned i = 0; i < Nvalue; i++)
+      {
+        if (element_pt->nodal_local_eqn(n, i) < 0)
+        {
+          Nvalue = 0;
+          break;
+        }
+      }
+    }
+
+    // Now check that the different values are uncoupled and that the
+    // blocks associated with each value are identical
+    for (unsigned n = 0; (n < n_node) && (Nvalue > 0); n++)
+    {
+      for (unsigned m = 0; (m < n_node) && (Nvalue > 0); m++)
+      {
+        const double block_entry = mass_matrix(
+          element_pt->nodal_local_eqn(n, 0), element_pt->nodal_local_eqn(m, 0));
+        for (unsigned i = 0; i < Nvalue; i++)
+        {
+          const int local_eqn = element_pt->nodal_local_eqn(n, i);
+          for (unsigned j = 0; j < Nvalue; j++)
+          {
+            const double entry =
+              mass_matrix(local_eqn, element_pt->nodal_local_eqn(m, j));
+            const double expected = (i == j) ? block_entry : 0.0;
+            if (std::fabs(entry - expected) > zero)
+            {
+              Nvalue = 0;
+              break;
+            }
+          }
+          if (Nvalue == 0)
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    // Copy the irreducible part of the mass matrix
+    Nrow = (Nvalue > 0) ? n_node : n_dof;
+    DenseDoubleMatrix block(Nrow, Nrow, 0.0);
+    for (unsigned l = 0; l < Nrow; l++)
+    {
+      for (unsigned m = 0; m < Nrow; m++)
+      {
+        if (Nvalue > 0)
+        {
+          block(l, m) = mass_matrix(element_pt->nodal_local_eqn(l, 0),
+                                    element_pt->nodal_local_eqn(m, 0));
+        }
+        else
+        {
+          block(l, m) = mass_matrix(l, m);
+        }
+      }
+    }
+
+    // Is it diagonal?
+    Is_diagonal = true;
+    for (unsigned l = 0; (l < Nrow) && Is_diagonal; l++)
+    {
+      for (unsigned m = 0; m < Nrow; m++)
+      {
+        if ((l != m) && (std::fabs(block(l, m)) > zero))
+        {
+          Is_diagonal = false;
+          break;
+        }
+      }
+    }
+
+    // If so, just store the reciprocals of the diagonal entries
+    if (Is_diagonal)
+    {
+      Inverse.resize(Nrow);
+      for (unsigned l = 0; l < Nrow; l++)
+      {
+        Inverse[l] = 1.0 / block(l, l);
+      }
+      return;
+    }
+
+    // Otherwise LU decompose the block (it will always be small) and
+    // store its inverse, which can then be applied to all values at once
+    block.ludecompose();
+    Inverse.resize(Nrow * Nrow);
+    Vector<double> column(Nrow);
+    for (unsigned m = 0; m < Nrow; m++)
+    {
+      for (unsigned l = 0; l < Nrow; l++)
+      {
+        column[l] = 0.0;
+      }
+      column[m] = 1.0;
+      block.lubksub(column);
+      for (unsigned l = 0; l < Nrow; l++)
+      {
+        Inverse[l * Nrow + m] = column[l];
+      }
+    }
+  }
+
+
+  //========================================================================
+  /// Overwrite rhs by scale times the product of the stored inverse
+  /// mass matrix and rhs.
+  //========================================================================
+  void DGMassMatrix::solve(DGElement* const& element_pt,
+                           const double& scale,
+                           Vector<double>& rhs) const
+  {
+    // A diagonal inverse can be applied in place
+    if (Is_diagonal)
+    {
+      if (Nvalue > 0)
+      {
+        for (unsigned l = 0; l < Nrow; l++)
+        {
+          const double inv = scale * Inverse[l];
+          for (unsigned i = 0; i < Nvalue; i++)
+          {
+            rhs[element_pt->nodal_local_eqn(l, i)] *= inv;
+          }
+        }
+      }
+      else
+      {
+        for (unsigned l = 0; l < Nrow; l++)
+        {
+          rhs[l] *= scale * Inverse[l];
+        }
+      }
+      return;
+    }
+
+    // Number of right-hand sides that share the stored block
+    const unsigned n_rhs = (Nvalue > 0) ? Nvalue : 1;
+
+    // Copy the entries of rhs into the workspace, one right-hand side
+    // after the other, so that every entry of the result is the dot
+    // product of two contiguous arrays
+    Workspace.resize(n_rhs * Nrow);
+    if (Nvalue > 0)
+    {
+      for (unsigned l = 0; l < Nrow; l++)
+      {
+        for (unsigned i = 0; i < Nvalue; i++)
+        {
+          Workspace[i * Nrow + l] = rhs[element_pt->nodal_local_eqn(l, i)];
+        }
+      }
+    }
+    else
+    {
+      std::copy(rhs.begin(), rhs.end(), Workspace.begin());
+    }
+
+    // Apply the (scaled) inverse to all right-hand sides and write the
+    // result straight back into rhs
+    for (unsigned l = 0; l < Nrow; l++)
+    {
+      const double* const inverse_l = &Inverse[l * Nrow];
+      for (unsigned i = 0; i < n_rhs; i++)
+      {
+        const double* const workspace_i = &Workspace[i * Nrow];
+        double sum = 0.0;
+        for (unsigned m = 0; m < Nrow; m++)
+        {
+          sum += inverse_l[m] * workspace_i[m];
+        }
+        if (Nvalue > 0)
+        {
+          rhs[element_pt->nodal_local_eqn(l, i)] = scale * sum;
+        }
+        else
+        {
+          rhs[l] = scale * sum;
+        }
+      }
+    }
+  }
 
-    // Resize and initialise the vector that will holds the residuals
-    Vector<double> dummy(n_dof, 0.0);
 
-    // Resize the mass matrix
-    M_pt->resize(n_dof, n_dof);
-    // Initialise the entries to zero
-    M_pt->initialise(0.0);
+  //========================================================================
+  /// Assemble the mass matrix and residuals of the element and store
+  /// the inverse of the mass matrix in storage that belongs to the element
+  //========================================================================
+  void DGElement::assemble_and_factorise_mass_matrix(Vector<double>& residuals)
+  {
+    // If we are using another element's mass matrix we must not overwrite
+    // it, so allocate our own storage
+    if (!Can_delete_mass_matrix)
+    {
+      M_pt = 0;
+      Can_delete_mass_matrix = true;
+    }
+    if (M_pt == 0)
+    {
+      M_pt = new DGMassMatrix;
+    }
+
     // Get the local mass matrix and residuals
-    this->fill_in_contribution_to_mass_matrix(dummy, *M_pt);
+    const unsigned n_dof = this->ndof();
+    DenseMatrix<double> mass_matrix(n_dof, n_dof, 0.0);
+    this->fill_in_contribution_to_mass_matrix(residuals, mass_matrix);
 
-    // Now invert the mass matrix it will always be small
-    // This can possibly be streamlined (for example in spectral
-    // elements the mass matrix is diagonal)
-    M_pt->ludecompose();
+    // Now store its inverse
+    M_pt->factorise(this, mass_matrix);
+    Mass_matrix_scale = 1.0;
 
     // The mass matrix has been computed
     Mass_matrix_has_been_computed = true;
   }
 
 
+  //========================================================================
+  ///\short Function that computes and stores the (inverse) mass matrix
+  //========================================================================
+  void DGElement::pre_compute_mass_matrix()
+  {
+    // Resize and initialise the vector that will holds the residuals
+    Vector<double> dummy(this->ndof(), 0.0);
+    assemble_and_factorise_mass_matrix(dummy);
+  }
+
+
+  //========================================================================
+  /// Return true if the mass matrix of this element is a multiple of
+  /// that of element_pt; ratio is the factor by which it exceeds it.
+  /// Assumes that the mass matrix depends only on the geometry, unless
+  /// either element reports otherwise.
+  //========================================================================
+  bool DGElement::has_similar_mass_matrix(DGElement* const& element_pt,
+                                          double& ratio,
+                                          const double& tolerance)
+  {
+    // The test below only compares the geometry of the two elements
+    if (!(this->mass_matrix_depends_only_on_geometry() &&
+          element_pt->mass_matrix_depends_only_on_geometry()))
+    {
+      return false;
+    }
+
+    // The elements must be of the same type, so that the shape functions
+    // are identical
+    if ((typeid(*this) != typeid(*element_pt)) ||
+        (this->ndof() != element_pt->ndof()))
+    {
+      return false;
+    }
+
+    // ... and they must use the same integration scheme (which may be
+    // stored separately in each element)
+    Integral* const integral_pt = this->integral_pt();
+    Integral* const other_integral_pt = element_pt->integral_pt();
+    const unsigned n_intpt = integral_pt->nweight();
+    if (integral_pt != other_integral_pt)
+    {
+      if ((typeid(*integral_pt) != typeid(*other_integral_pt)) ||
+          (other_integral_pt->nweight() != n_intpt))
+      {
+        return false;
+      }
+      const unsigned n_dim = this->dim();
+      for (unsigned ipt = 0; ipt < n_intpt; ipt++)
+      {
+        if (integral_pt->weight(ipt) != other_integral_pt->weight(ipt))
+        {
+          return false;
+        }
+        for (unsigned i = 0; i < n_dim; i++)
+        {
+          if (integral_pt->knot(ipt, i) != other_integral_pt->knot(ipt, i))
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    // The local equation numbering must be identical
+    const unsigned n_node = this->nnode();
+    for (unsigned n = 0; n < n_node; n++)
+    {
+      const unsigned n_value = this->node_pt(n)->nvalue();
+      if (element_pt->node_pt(n)->nvalue() != n_value)
+      {
+        return false;
+      }
+      for (unsigned i = 0; i < n_value; i++)
+      {
+        if (this->nodal_local_eqn(n, i) != element_pt->nodal_local_eqn(n, i))
+        {
+          return false;
+        }
+      }
+    }
+
+    // The ratio of the Jacobians must be the same at all integration points
+    if (n_intpt == 0)
+    {
+      return false;
+    }
+    ratio = this->J_eulerian_at_knot(0) / element_pt->J_eulerian_at_knot(0);
+    for (unsigned ipt = 1; ipt < n_intpt; ipt++)
+    {
+      const double J = this->J_eulerian_at_knot(ipt);
+      if (std::fabs(J - ratio * element_pt->J_eulerian_at_knot(ipt)) >
+          tolerance * std::fabs(J))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+
   //============================================================================
   /// Function that returns the current value of the residuals
   /// multiplied by the inverse mass matrix (virtual so that it can be
@@ -629,11 +962,6 @@ namespace oomph
 
     // Now let's assemble stuff
     const unsigned n_dof = this->ndof();
-    // Allocate storage for the local mass matrix (if required)
-    if (M_pt == 0)
-    {
-      M_pt = new DenseDoubleMatrix;
-    }
 
     // Resize and initialise the vector that will holds the residuals
     minv_res.resize(n_dof);
@@ -648,27 +976,15 @@ namespace oomph
       // Get the residuals
       this->fill_in_contribution_to_residuals(minv_res);
     }
-    // Otherwise
+    // Otherwise get the local mass matrix and residuals and store
+    // the inverse of the mass matrix
     else
     {
-      // Resize the mass matrix
-      M_pt->resize(n_dof, n_dof);
-      // Initialise the entries to zero
-      M_pt->initialise(0.0);
-      // Get the local mass matrix and residuals
-      this->fill_in_contribution_to_mass_matrix(minv_res, *M_pt);
-
-      // Now invert the mass matrix it will always be small
-      // This can possibly be streamlined (for example in spectral
-      // elements the mass matrix is diagonal)
-      M_pt->ludecompose();
-
-      // The mass matrix has been computed
-      Mass_matrix_has_been_computed = true;
+      assemble_and_factorise_mass_matrix(minv_res);
     }
 
-    // Always do the backsubstitution
-    M_pt->lubksub(minv_res);
+    // Always apply the (scaled) inverse mass matrix
+    M_pt->solve(this, Mass_matrix_scale, minv_res);
   }
 
 
@@ -734,6 +1050,73 @@ namespace oomph
   double DGMesh::FaceTolerance = 1.0e-10;
 
 
+  //========================================================================
+  /// Make all elements whose mass matrices are multiples of each other
+  /// share a single inverse mass matrix and enable the reuse of the mass
+  /// matrices. Returns the number of distinct mass matrices.
+  //========================================================================
+  unsigned DGMesh::share_mass_matrices(const double& tolerance)
+  {
+    // Candidate elements are binned by the ratios of their Jacobians at
+    // the integration points to that at the first one, rounded to a
+    // resolution coarser than the tolerance. Similar elements that end up
+    // in different bins are not detected, which is safe but wasteful.
+    const double resolution = 10.0 * tolerance;
+    std::map<std::vector<double>, Vector<DGElement*>> reference_element_pt;
+
+    unsigned n_mass_matrix = 0;
+    const unsigned n_element = this->nelement();
+    for (unsigned e = 0; e < n_element; e++)
+    {
+      DGElement* const elem_pt = dynamic_cast<DGElement*>(this->element_pt(e));
+
+      // Discard any previous sharing and (re)enable the reuse
+      elem_pt->disable_mass_matrix_reuse();
+      elem_pt->enable_mass_matrix_reuse();
+
+      // Work out the bin
+      const unsigned n_intpt = elem_pt->integral_pt()->nweight();
+      std::vector<double> key(n_intpt, 0.0);
+      if (n_intpt > 0)
+      {
+        const double J0 = elem_pt->J_eulerian_at_knot(0);
+        for (unsigned ipt = 0; ipt < n_intpt; ipt++)
+        {
+          key[ipt] = resolution *
+                     std::floor(elem_pt->J_eulerian_at_knot(ipt) /
+                                  (J0 * resolution) +
+                                0.5);
+        }
+      }
+
+      // Look for a similar element in the bin
+      Vector<DGElement*>& candidate_pt = reference_element_pt[key];
+      const unsigned n_candidate = candidate_pt.size();
+      bool found = false;
+      for (unsigned c = 0; c < n_candidate; c++)
+      {
+        double ratio = 1.0;
+        if (elem_pt->has_similar_mass_matrix(candidate_pt[c], ratio, tolerance))
+        {
+          elem_pt->set_mass_matrix_from_element(candidate_pt[c], ratio);
+          found = true;
+          break;
+        }
+      }
+
+      // Otherwise the element computes its own mass matrix and becomes
+      // a reference for other elements
+      if (!found)
+      {
+        elem_pt->pre_compute_mass_matrix();
+        candidate_pt.push_back(elem_pt);
+        n_mass_matrix++;
+      }
+    }
+    return n_mass_matrix;
+  }
+
+
   //====================================================
   /// Helper minmod function
   //====================================================
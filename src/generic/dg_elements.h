@@ -151,9 +151,85 @@ namespace oomph
                                 unsigned flag);
   };
 
+  class DGElement;
   class DGMesh;
   class SlopeLimiter;
 
+  //==================================================================
+  /// \short Storage for the inverse of a DGElement's mass matrix, which
+  /// may be shared between several geometrically similar elements.
+  /// If the mass matrix consists of identical blocks, one for each value
+  /// stored at the nodes (as is the case for all flux-transport elements),
+  /// only the inverse of a single block is stored and it is applied to
+  /// all values at once. If that block is diagonal (e.g. spectral
+  /// elements with collocated integration) only the reciprocals of its
+  /// diagonal entries are stored.
+  //==================================================================
+  class DGMassMatrix
+  {
+  public:
+    /// Constructor, initialise to an empty (full) matrix
+    DGMassMatrix() : Nvalue(0), Nrow(0), Is_diagonal(false) {}
+
+    /// Broken copy constructor
+    DGMassMatrix(const DGMassMatrix&)
+    {
+      BrokenCopy::broken_copy("DGMassMatrix");
+    }
+
+    /// Broken assignment operator
+    void operator=(const DGMassMatrix&)
+    {
+      BrokenCopy::broken_assign("DGMassMatrix");
+    }
+
+    ///\short Detect the structure of the (assembled) mass matrix of
+    /// element_pt and store the inverse of its irreducible part
+    void factorise(DGElement* const& element_pt,
+                   const DenseMatrix<double>& mass_matrix);
+
+    ///\short Overwrite rhs by scale times the product of the stored
+    /// inverse and rhs. element_pt provides the nodal equation numbering
+    /// if the inverse is stored blockwise.
+    void solve(DGElement* const& element_pt,
+               const double& scale,
+               Vector<double>& rhs) const;
+
+    /// \short Return the number of values per node that share the stored
+    /// block (zero if the full matrix is stored)
+    unsigned nvalue() const
+    {
+      return Nvalue;
+    }
+
+    /// Return whether the stored (block of the) mass matrix is diagonal
+    bool is_diagonal() const
+    {
+      return Is_diagonal;
+    }
+
+  private:
+    /// \short Number of values per node that share the stored block, zero
+    /// if the full mass matrix is stored
+    unsigned Nvalue;
+
+    /// Number of rows in the stored (block of the) inverse mass matrix
+    unsigned Nrow;
+
+    /// Boolean flag to indicate that the stored block is diagonal
+    bool Is_diagonal;
+
+    ///\short The entries of the inverse, stored row-wise, or only its
+    /// diagonal entries if the mass matrix is diagonal
+    Vector<double> Inverse;
+
+    ///\short Workspace used by solve(...) to hold a copy of the
+    /// right-hand sides, kept to avoid reallocation on every call. (Hence
+    /// solve(...) must not be called concurrently by elements that share
+    /// this storage.)
+    mutable Vector<double> Workspace;
+  };
+
   //==================================================================
   /// A Base class for DGElements
   //=================================================================
@@ -170,9 +246,14 @@ namespace oomph
     /// Pointer to Mesh, which will be responsible for the neighbour finding
     DGMesh* DG_mesh_pt;
 
-    ///\short Pointer to storage for a mass matrix that can be recycled if
-    /// desired
-    DenseDoubleMatrix* M_pt;
+    ///\short Pointer to storage for the inverse mass matrix that can be
+    /// recycled if desired, and shared with geometrically similar elements
+    DGMassMatrix* M_pt;
+
+    ///\short Factor by which the (possibly shared) inverse mass matrix
+    /// addressed by M_pt must be scaled to give this element's inverse
+    /// mass matrix
+    double Mass_matrix_scale;
 
     /// \short Pointer to storage for the average values of the of the
     /// variables over the element
@@ -195,11 +276,16 @@ namespace oomph
       return 0;
     }
 
+    ///\short Assemble the mass matrix and residuals of the element and
+    /// store the inverse of the mass matrix in (unshared) storage
+    void assemble_and_factorise_mass_matrix(Vector<double>& residuals);
+
   public:
     /// Constructor, initialise the pointers to zero
     DGElement()
       : DG_mesh_pt(0),
         M_pt(0),
+        Mass_matrix_scale(1.0),
         Average_value(0),
         Mass_matrix_reuse_is_enabled(false),
         Mass_matrix_has_been_computed(false),
@@ -233,7 +319,12 @@ namespace oomph
     void enable_mass_matrix_reuse()
     {
       Mass_matrix_reuse_is_enabled = true;
-      Mass_matrix_has_been_computed = false;
+      // If we are using another element's mass matrix it has already been
+      // computed; otherwise we must (re)compute our own
+      if (Can_delete_mass_matrix)
+      {
+        Mass_matrix_has_been_computed = false;
+      }
     }
 
     /// Function that disables the reuse of the mass matrix
@@ -244,6 +335,8 @@ namespace oomph
       if (!Can_delete_mass_matrix)
       {
         M_pt = 0;
+        Mass_matrix_scale = 1.0;
+        Can_delete_mass_matrix = true;
       }
       // Otherwise we do not reuse the mass matrix
       Mass_matrix_reuse_is_enabled = false;
@@ -252,8 +345,11 @@ namespace oomph
     }
 
 
-    /// Set the mass matrix to point to one in another element
-    virtual void set_mass_matrix_from_element(DGElement* const& element_pt)
+    ///\short Set the mass matrix to point to one in another element.
+    /// The optional ratio is the factor by which the mass matrix of this
+    /// element exceeds that of element_pt (see has_similar_mass_matrix(...))
+    virtual void set_mass_matrix_from_element(DGElement* const& element_pt,
+                                              const double& ratio = 1.0)
     {
       // If the element's mass matrix has not been computed, compute it!
       if (!element_pt->mass_matrix_has_been_computed())
@@ -261,9 +357,16 @@ namespace oomph
         element_pt->pre_compute_mass_matrix();
       }
 
+      // Clean up any mass matrix that we created ourselves
+      if ((M_pt != 0) && Can_delete_mass_matrix && (M_pt != element_pt->M_pt))
+      {
+        delete M_pt;
+      }
+
       // Now set the mass matrix in this element to address that
-      // of element_pt
+      // of element_pt, scaled by the ratio of the two mass matrices
       this->M_pt = element_pt->M_pt;
+      Mass_matrix_scale = element_pt->Mass_matrix_scale / ratio;
       // We must reuse the mass matrix, or there will be trouble
       // Because we will recalculate it in the original element
       Mass_matrix_reuse_is_enabled = true;
@@ -275,6 +378,31 @@ namespace oomph
     ///\short Function that computes and stores the (inverse) mass matrix
     void pre_compute_mass_matrix();
 
+    ///\short Return true if the mass matrix of this element is a multiple
+    /// of that of element_pt. This is the case if the two elements are of
+    /// the same type, with the same local equation numbering, and the ratio
+    /// of their Jacobians is the same at all integration points (e.g. for
+    /// affine elements of the same shape). On return, ratio is the factor
+    /// by which this element's mass matrix exceeds that of element_pt.
+    /// The test assumes that the mass matrix depends only on the element's
+    /// geometry (the shape functions, the integration scheme and the
+    /// Jacobian of the mapping); it always returns false if either element
+    /// reports otherwise via mass_matrix_depends_only_on_geometry().
+    bool has_similar_mass_matrix(DGElement* const& element_pt,
+                                 double& ratio,
+                                 const double& tolerance = 1.0e-12);
+
+    ///\short Does the mass matrix depend only on the element's geometry
+    /// (the shape functions, the integration scheme and the Jacobian of the
+    /// mapping)? True by default; elements whose mass matrix also depends
+    /// on other quantities (e.g. a spatially varying coefficient or the
+    /// unknowns) must overload this to return false, so that their mass
+    /// matrices are not shared by DGMesh::share_mass_matrices(...).
+    virtual bool mass_matrix_depends_only_on_geometry() const
+    {
+      return true;
+    }
+
     // Function that is used to construct all the faces of the DGElement
     virtual void build_all_faces() = 0;
 
@@ -467,6 +595,13 @@ namespace oomph
 
     virtual ~DGMesh() {}
 
+    ///\short Make all elements whose mass matrices are multiples of each
+    /// other (see DGElement::has_similar_mass_matrix(...)) share a single
+    /// inverse mass matrix, and enable the reuse of the mass matrices in
+    /// all elements. Returns the number of distinct mass matrices that are
+    /// stored. Any previous sharing is discarded first.
+    unsigned share_mass_matrices(const double& tolerance = 1.0e-12);
+
     virtual void neighbour_finder(FiniteElement* const& bulk_element_pt,
                                   const int& face_index,
                                   const Vector<double>& s_bulk,
@@ -29,6 +29,47 @@
 
 namespace oomph
 {
+  //============================================================================
+  /// Set the distribution and provide (uninitialised) storage for the
+  /// local values
+  //============================================================================
+  void DoubleVector::allocate_values(
+    const LinearAlgebraDistribution* const& dist_pt)
+  {
+    // If we already own storage of the right size, re-use it rather than
+    // re-allocating (vectors are typically re-built with the same
+    // distribution over and over again, e.g. in preconditioner solves)
+    if (Built && Internal_values && dist_pt->built() &&
+        (this->nrow_local() == dist_pt->nrow_local()))
+    {
+      if (dist_pt != this->distribution_pt())
+      {
+        this->build_distribution(dist_pt);
+      }
+      return;
+    }
+
+    // clean the memory
+    this->clear();
+
+    // the vector owns the internal data
+    Internal_values = true;
+
+    // Set the distribution
+    this->build_distribution(dist_pt);
+
+    // allocate the values
+    if (dist_pt->built())
+    {
+      Values_pt = new double[this->nrow_local()];
+      Built = true;
+    }
+    else
+    {
+      Built = false;
+    }
+  }
+
   //============================================================================
   /// Just copys the argument DoubleVector
   //============================================================================
@@ -36,11 +77,9 @@ namespace oomph
   {
     if (!(*this == old_vector))
     {
-      // the vector owns the internal data
-      Internal_values = true;
-
-      // reset the distribution and resize the data
-      this->build(old_vector.distribution_pt(), 0.0);
+      // reset the distribution and provide storage (no need to initialise
+      // the values since they're overwritten straight away)
+      this->allocate_values(old_vector.distribution_pt());
 
       // copy the data
       if (this->distribution_built())
@@ -59,27 +98,10 @@ namespace oomph
   void DoubleVector::build(const LinearAlgebraDistribution* const& dist_pt,
                            const double& v)
   {
-    // clean the memory
-    this->clear();
-
-    // the vector owns the internal data
-    Internal_values = true;
-
-    // Set the distribution
-    this->build_distribution(dist_pt);
-
-    // update the values
-    if (dist_pt->built())
-    {
-      unsigned nrow_local = this->nrow_local();
-      Values_pt = new double[nrow_local];
-
-      std::fill_n(Values_pt, nrow_local, v);
-      Built = true;
-    }
-    else
+    this->allocate_values(dist_pt);
+    if (Built)
     {
-      Built = false;
+      std::fill_n(Values_pt, this->nrow_local(), v);
     }
   }
 
@@ -91,20 +113,11 @@ namespace oomph
   void DoubleVector::build(const LinearAlgebraDistribution* const& dist_pt,
                            const Vector<double>& v)
   {
-    // clean the memory
-    this->clear();
-
-    // the vector owns the internal data
-    Internal_values = true;
-
-    // Set the distribution
-    this->build_distribution(dist_pt);
+    // provide storage; the values are copied from v
+    this->allocate_values(dist_pt);
 
     // use the initialise method to populate the vector
     this->initialise(v);
-
-    // indicate that its built
-    Built = true;
   }
 
   //============================================================================
@@ -125,7 +138,7 @@ namespace oomph
   /// \short initialise the vector with coefficient from the vector v.
   /// Note: The vector v must be of length
   //============================================================================
-  void DoubleVector::initialise(const Vector<double> v)
+  void DoubleVector::initialise(const Vector<double>& v)
   {
 #ifdef PARANOID
     if (v.size() != this->nrow())
@@ -136,7 +136,7 @@ namespace oomph
 
     /// \short initialise the vector with coefficient from the vector v.
     /// Note: The vector v must be of length
-    void initialise(const Vector<double> v);
+    void initialise(const Vector<double>& v);
 
     /// \short wipes the DoubleVector
     void clear()
@@ -315,6 +315,12 @@ namespace oomph
     double norm(const CRDoubleMatrix* matrix_pt) const;
 
   private:
+    /// \short Set the distribution and provide (uninitialised) storage for
+    /// the local values: existing storage of the right size is re-used,
+    /// otherwise new storage is allocated. The values are not touched so
+    /// the caller's fill or copy is the only pass over the memory.
+    void allocate_values(const LinearAlgebraDistribution* const& dist_pt);
+
     /// the local vector
     double* Values_pt;
 
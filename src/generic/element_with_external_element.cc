@@ -248,6 +248,7 @@ namespace oomph
   {
     // Reset number of stored field data to zero
     Nexternal_interaction_field_data = 0;
+    External_interaction_field_data_element_pt.clear();
     // Clear all the internal field data storage, if it's been allocated
     if (External_interaction_field_data_pt)
     {
@@ -267,6 +268,7 @@ namespace oomph
 
     // Reset number of stored geometric data to zero
     Nexternal_interaction_geometric_data = 0;
+    External_interaction_geometric_data_element_pt.clear();
     // Clear all internal external data storage, if it's been allocated
     if (External_interaction_geometric_data_pt)
     {
@@ -496,6 +498,10 @@ namespace oomph
             }
           }
         }
+
+        // Record which external elements are affected by which data
+        setup_external_interaction_data_element_lookup(
+          external_interaction_elements_pt);
       }
 
       // All external interaction data has now been specified
@@ -627,6 +633,137 @@ namespace oomph
     }
   }
 
+  //==========================================================================
+  /// Set up the lookup schemes that record which of the external elements
+  /// are affected by each external interaction field and geometric datum.
+  /// This allows the FD loops to restrict any updates to the external
+  /// elements that actually depend on the perturbed value, rather than
+  /// updating all of them for every perturbation.
+  //==========================================================================
+  void ElementWithExternalElement::
+    setup_external_interaction_data_element_lookup(
+      Vector<std::set<FiniteElement*>> const& external_elements_pt)
+  {
+    // Merge the external elements of all interactions
+    std::set<FiniteElement*> all_external_element_pt;
+    const unsigned n_interaction = external_elements_pt.size();
+    for (unsigned i = 0; i < n_interaction; i++)
+    {
+      all_external_element_pt.insert(external_elements_pt[i].begin(),
+                                     external_elements_pt[i].end());
+    }
+
+    // Lookup schemes from the (paired) data to their index in the
+    // element's external interaction data storage
+    std::map<std::pair<Data*, unsigned>, unsigned> field_data_index;
+    const unsigned n_field = Nexternal_interaction_field_data;
+    for (unsigned i = 0; i < n_field; i++)
+    {
+      field_data_index[std::make_pair(
+        External_interaction_field_data_pt[i],
+        External_interaction_field_data_index[i])] = i;
+    }
+    std::map<std::pair<Data*, unsigned>, unsigned> geometric_data_index;
+    const unsigned n_geom = Nexternal_interaction_geometric_data;
+    for (unsigned i = 0; i < n_geom; i++)
+    {
+      geometric_data_index[std::make_pair(
+        External_interaction_geometric_data_pt[i],
+        External_interaction_geometric_data_index[i])] = i;
+    }
+
+    External_interaction_field_data_element_pt.clear();
+    External_interaction_field_data_element_pt.resize(n_field);
+    External_interaction_geometric_data_element_pt.clear();
+    External_interaction_geometric_data_element_pt.resize(n_geom);
+
+    // Keep track of the data that we have been able to associate with
+    // specific external elements
+    std::vector<bool> field_data_found(n_field, false);
+    std::vector<bool> geometric_data_found(n_geom, false);
+
+    // Loop over the external elements
+    for (std::set<FiniteElement*>::iterator it =
+           all_external_element_pt.begin();
+         it != all_external_element_pt.end();
+         it++)
+    {
+      FiniteElement* el_pt = *it;
+
+      // Field data that affect the element
+      std::set<std::pair<Data*, unsigned>> paired_field_data;
+      el_pt->identify_field_data_for_interactions(paired_field_data);
+      for (std::set<std::pair<Data*, unsigned>>::iterator it_data =
+             paired_field_data.begin();
+           it_data != paired_field_data.end();
+           it_data++)
+      {
+        std::map<std::pair<Data*, unsigned>, unsigned>::iterator it_index =
+          field_data_index.find(*it_data);
+        if (it_index != field_data_index.end())
+        {
+          External_interaction_field_data_element_pt[it_index->second]
+            .push_back(el_pt);
+          field_data_found[it_index->second] = true;
+        }
+      }
+
+      // Geometric data that affect the element
+      if (n_geom > 0)
+      {
+        std::set<Data*> geometric_data_pt;
+        el_pt->identify_geometric_data(geometric_data_pt);
+        for (std::set<Data*>::iterator it_data = geometric_data_pt.begin();
+             it_data != geometric_data_pt.end();
+             it_data++)
+        {
+          const unsigned n_value = (*it_data)->nvalue();
+          for (unsigned j = 0; j < n_value; j++)
+          {
+            std::map<std::pair<Data*, unsigned>, unsigned>::iterator
+              it_index = geometric_data_index.find(
+                std::make_pair(*it_data, j));
+            if (it_index != geometric_data_index.end())
+            {
+              External_interaction_geometric_data_element_pt[it_index->second]
+                .push_back(el_pt);
+              geometric_data_found[it_index->second] = true;
+            }
+          }
+        }
+      }
+    }
+
+    // Any data that could not be associated with specific external
+    // elements (e.g. because an overloaded version of
+    // identify_all_*_data_for_external_interaction() added them) are
+    // assumed to affect all external elements
+    Vector<FiniteElement*> all_el_pt;
+    all_el_pt.reserve(all_external_element_pt.size());
+    for (std::set<FiniteElement*>::iterator it =
+           all_external_element_pt.begin();
+         it != all_external_element_pt.end();
+         it++)
+    {
+      all_el_pt.push_back(*it);
+    }
+    for (unsigned i = 0; i < n_field; i++)
+    {
+      if (!field_data_found[i])
+      {
+        External_interaction_field_data_element_pt[i] = all_el_pt;
+      }
+    }
+    for (unsigned i = 0; i < n_geom; i++)
+    {
+      if (!geometric_data_found[i])
+      {
+        External_interaction_geometric_data_element_pt[i] = all_el_pt;
+      }
+    }
+  }
+
+
   //============================================================================
   /// This function calculates the entries of Jacobian matrix, used in
   /// the Newton method, associated with the external interaction
@@ -525,7 +525,58 @@ namespace oomph
     /// interactions in the elemenet
     Data** External_interaction_geometric_data_pt;
 
+    /// \short Return the external elements whose residuals (or nodal
+    /// positions) are affected by the i-th external interaction field
+    /// datum. This can be used in the update_in_external_interaction_*_fd()
+    /// functions to restrict updates to the relevant external elements.
+    const Vector<FiniteElement*>& external_elements_affected_by_field_data(
+      const unsigned& i) const
+    {
+#ifdef RANGE_CHECKING
+      if (i >= External_interaction_field_data_element_pt.size())
+      {
+        std::ostringstream error_message;
+        error_message << "Range Error: External interaction field data " << i
+                      << " is not in the range (0,"
+                      << External_interaction_field_data_element_pt.size() - 1
+                      << ")";
+        throw OomphLibError(error_message.str(),
+                            OOMPH_CURRENT_FUNCTION,
+                            OOMPH_EXCEPTION_LOCATION);
+      }
+#endif
+      return External_interaction_field_data_element_pt[i];
+    }
+
+    /// \short Return the external elements whose geometry is affected by
+    /// the i-th external interaction geometric datum.
+    const Vector<FiniteElement*>& external_elements_affected_by_geometric_data(
+      const unsigned& i) const
+    {
+#ifdef RANGE_CHECKING
+      if (i >= External_interaction_geometric_data_element_pt.size())
+      {
+        std::ostringstream error_message;
+        error_message
+          << "Range Error: External interaction geometric data " << i
+          << " is not in the range (0,"
+          << External_interaction_geometric_data_element_pt.size() - 1 << ")";
+        throw OomphLibError(error_message.str(),
+                            OOMPH_CURRENT_FUNCTION,
+                            OOMPH_EXCEPTION_LOCATION);
+      }
+#endif
+      return External_interaction_geometric_data_element_pt[i];
+    }
+
   private:
+    /// \short Set up the lookup schemes that record which of the external
+    /// elements are affected by each external interaction field and
+    /// geometric datum. Data that cannot be associated with any specific
+    /// external element are (conservatively) taken to affect all of them.
+    void setup_external_interaction_data_element_lookup(
+      Vector<std::set<FiniteElement*>> const& external_elements_pt);
+
     /// \short Helper function to check that storage has actually been allocated
     void check_storage_allocated() const
     {
@@ -627,6 +678,17 @@ namespace oomph
     /// \short Storage for the local equation number associated with the
     /// external geometric data the affect the interactions in the element
     int* External_interaction_geometric_data_local_eqn;
+
+    /// \short External_interaction_field_data_element_pt[i] contains
+    /// the external elements that are affected by the i-th external
+    /// interaction field datum
+    Vector<Vector<FiniteElement*>> External_interaction_field_data_element_pt;
+
+    /// \short External_interaction_geometric_data_element_pt[i] contains
+    /// the external elements whose geometry is affected by the i-th external
+    /// interaction geometric datum
+    Vector<Vector<FiniteElement*>>
+      External_interaction_geometric_data_element_pt;
   };
 } // namespace oomph
 
@@ -155,6 +155,126 @@ namespace oomph
     {
       Geom_data_pt.push_back(*it);
     }
+
+    // Now set up the lookup scheme that identifies the (master) nodes
+    // whose position is affected by each geometric Data item
+    const unsigned n_geom_data = Geom_data_pt.size();
+    std::map<Data*, unsigned> geom_data_index;
+    for (unsigned i = 0; i < n_geom_data; i++)
+    {
+      geom_data_index[Geom_data_pt[i]] = i;
+    }
+    Geom_data_dependent_node_pt.clear();
+    Geom_data_dependent_node_pt.resize(n_geom_data);
+
+    // Set of (master) nodes that have already been processed
+    std::set<Node*> done_node_pt;
+
+    // Loop over all nodes
+    const unsigned n_node = this->nnode();
+    for (unsigned n = 0; n < n_node; n++)
+    {
+      // Cache pointer to the Node
+      Node* const nod_pt = this->node_pt(n);
+
+      // Hanging nodes are updated via their master nodes
+      unsigned nmaster = 1;
+      HangInfo* hang_info_pt = 0;
+      if (nod_pt->is_hanging())
+      {
+        hang_info_pt = nod_pt->hanging_pt();
+        nmaster = hang_info_pt->nmaster();
+      }
+
+      // Loop over all master nodes
+      for (unsigned imaster = 0; imaster < nmaster; imaster++)
+      {
+        Node* master_node_pt = nod_pt;
+        if (hang_info_pt != 0)
+        {
+          master_node_pt = hang_info_pt->master_node_pt(imaster);
+        }
+
+        // Only process each master node once
+        if (!done_node_pt.insert(master_node_pt).second) continue;
+
+        // Find all geometric Data that affect the master node
+        std::set<unsigned> node_geom_data_index;
+        const unsigned n_node_geom_data = master_node_pt->ngeom_data();
+        if (n_node_geom_data > 0)
+        {
+          Data** node_geom_data_pt = master_node_pt->all_geom_data_pt();
+          for (unsigned i = 0; i < n_node_geom_data; i++)
+          {
+            std::map<Data*, unsigned>::iterator it =
+              geom_data_index.find(node_geom_data_pt[i]);
+#ifdef PARANOID
+            if (it == geom_data_index.end())
+            {
+              throw OomphLibError(
+                "Geometric Data of a node is not in Geom_data_pt",
+                OOMPH_CURRENT_FUNCTION,
+                OOMPH_EXCEPTION_LOCATION);
+            }
+#endif
+            node_geom_data_index.insert(it->second);
+          }
+        }
+        const unsigned n_geom_obj = master_node_pt->ngeom_object();
+        if (n_geom_obj > 0)
+        {
+          GeomObject** geom_object_pt = master_node_pt->all_geom_object_pt();
+          for (unsigned i = 0; i < n_geom_obj; i++)
+          {
+            const unsigned n_obj_geom_data = geom_object_pt[i]->ngeom_data();
+            for (unsigned idata = 0; idata < n_obj_geom_data; idata++)
+            {
+              std::map<Data*, unsigned>::iterator it =
+                geom_data_index.find(geom_object_pt[i]->geom_data_pt(idata));
+#ifdef PARANOID
+              if (it == geom_data_index.end())
+              {
+                throw OomphLibError(
+                  "Geometric Data of a GeomObject is not in Geom_data_pt",
+                  OOMPH_CURRENT_FUNCTION,
+                  OOMPH_EXCEPTION_LOCATION);
+              }
+#endif
+              node_geom_data_index.insert(it->second);
+            }
+          }
+        }
+
+        // Record the dependency
+        for (std::set<unsigned>::iterator it = node_geom_data_index.begin();
+             it != node_geom_data_index.end();
+             it++)
+        {
+          Geom_data_dependent_node_pt[*it].push_back(master_node_pt);
+        }
+      }
+    }
+  }
+
+
+  //=================================================================
+  /// Update the position of the nodes that are affected by the i-th
+  /// geometric Data item. If selective node updates are disabled
+  /// (the default) we simply update the entire element.
+  //=================================================================
+  void ElementWithMovingNodes::node_update_for_geom_data(const unsigned& i)
+  {
+    if (!Selective_node_update_during_fd)
+    {
+      this->node_update();
+      return;
+    }
+
+    const unsigned n_dependent_node = Geom_data_dependent_node_pt[i].size();
+    for (unsigned n = 0; n < n_dependent_node; n++)
+    {
+      Geom_data_dependent_node_pt[i][n]->node_update();
+    }
   }
 
   //==================================================================
@@ -418,8 +538,8 @@ namespace oomph
                 // Increment the variable
                 *value_pt += fd_step;
 
-                // Update the whole element (Bit inefficient)
-                this->node_update();
+                // Update the nodes affected by the perturbation
+                node_update_for_geom_data(i);
 
                 // Calculate the new residuals
                 this->get_residuals(newres);
@@ -435,14 +555,23 @@ namespace oomph
                 // Reset the variable
                 *value_pt = old_var;
 
-                // We're relying on the total node update in the next loop
+                // If we only updated selected nodes we have to reset them
+                // now; otherwise we're relying on the total node update
+                // in the next loop
+                if (Selective_node_update_during_fd)
+                {
+                  node_update_for_geom_data(i);
+                }
               }
             }
           }
 
           // Node update the element one final time to get things back to
           // the original state
-          this->node_update();
+          if (!Selective_node_update_during_fd)
+          {
+            this->node_update();
+          }
         }
 
         break;
@@ -485,31 +614,55 @@ namespace oomph
 
           get_dnodal_coordinates_dgeom_dofs(dnodal_coordinates_dgeom_dofs);
 
-          // Assemble Jacobian via chain rule
-          for (unsigned l = 0; l < n_dof; l++)
+          // Assemble Jacobian via chain rule. Each geometric dof typically
+          // only affects the position of a few of the element's nodes, so
+          // we first identify the non-zero entries in
+          // dnodal_coordinates_dgeom_dofs(k,.,.) and then only loop over
+          // those when forming the product.
+          Vector<unsigned> nonzero_coord;
+          Vector<unsigned> nonzero_node;
+
+          // Loop over the Data items that affect the node update operations
+          for (unsigned i_data = 0; i_data < n_geometric_data; i_data++)
           {
-            // Loop over the Data items that affect the node update operations
-            for (unsigned i_data = 0; i_data < n_geometric_data; i_data++)
+            // Loop over values
+            unsigned n_value = Geom_data_pt[i_data]->nvalue();
+            for (unsigned j_val = 0; j_val < n_value; j_val++)
             {
-              // Loop over values
-              unsigned n_value = Geom_data_pt[i_data]->nvalue();
-              for (unsigned j_val = 0; j_val < n_value; j_val++)
-              {
-                int k = geometric_data_local_eqn(i_data, j_val);
+              int k = geometric_data_local_eqn(i_data, j_val);
 
-                // If the value is free
-                if (k >= 0)
+              // If the value is free
+              if (k >= 0)
+              {
+                // Find the nodal coordinates that are affected by this dof
+                nonzero_coord.clear();
+                nonzero_node.clear();
+                for (unsigned i = 0; i < dim_nod; i++)
                 {
-                  jacobian(l, k) = 0.0;
-                  for (unsigned i = 0; i < dim_nod; i++)
+                  for (unsigned j = 0; j < n_shape_controlling_node; j++)
                   {
-                    for (unsigned j = 0; j < n_shape_controlling_node; j++)
+                    if (dnodal_coordinates_dgeom_dofs(k, i, j) != 0.0)
                     {
-                      jacobian(l, k) += dresidual_dnodal_coordinates(l, i, j) *
-                                        dnodal_coordinates_dgeom_dofs(k, i, j);
+                      nonzero_coord.push_back(i);
+                      nonzero_node.push_back(j);
                     }
                   }
                 }
+
+                // Now do the (sparse) contraction for all residuals
+                const unsigned n_nonzero = nonzero_coord.size();
+                for (unsigned l = 0; l < n_dof; l++)
+                {
+                  double sum = 0.0;
+                  for (unsigned e = 0; e < n_nonzero; e++)
+                  {
+                    const unsigned i = nonzero_coord[e];
+                    const unsigned j = nonzero_node[e];
+                    sum += dresidual_dnodal_coordinates(l, i, j) *
+                           dnodal_coordinates_dgeom_dofs(k, i, j);
+                  }
+                  jacobian(l, k) = sum;
+                }
               }
             }
           }
@@ -637,8 +790,8 @@ namespace oomph
           // Increment the variable
           *value_pt += fd_step;
 
-          // Update the whole element
-          this->node_update();
+          // Update the nodes affected by the perturbation
+          node_update_for_geom_data(i);
 
           // Loop over all shape-controlling nodes
           for (std::map<Node*, unsigned>::iterator it =
@@ -663,13 +816,22 @@ namespace oomph
           // Reset the variable
           *value_pt = old_var;
 
-          // We're relying on the total node update in the next loop
+          // If we only updated selected nodes we have to reset them
+          // now; otherwise we're relying on the total node update in the
+          // next loop
+          if (Selective_node_update_during_fd)
+          {
+            node_update_for_geom_data(i);
+          }
         }
       }
     }
     // Node update the element one final time to get things back to
     // the original state
-    this->node_update();
+    if (!Selective_node_update_during_fd)
+    {
+      this->node_update();
+    }
   }
 
 } // namespace oomph
@@ -77,7 +77,8 @@ namespace oomph
       : Geometric_data_local_eqn(0),
         Bypass_fill_in_jacobian_from_geometric_data(false),
         Evaluate_dresidual_dnodal_coordinates_by_fd(false),
-        Method_for_shape_derivs(Shape_derivs_by_direct_fd)
+        Method_for_shape_derivs(Shape_derivs_by_direct_fd),
+        Selective_node_update_during_fd(false)
     // hierher: Anything other than the fd-based method is currently broken;
     // at least for refineable elements -- this all needs to be checked
     // VERY carefully again (see instructions in commit log). Until this
@@ -295,6 +296,31 @@ namespace oomph
       return Bypass_fill_in_jacobian_from_geometric_data;
     }
 
+    /// \short When finite-differencing w.r.t. the geometric data, only
+    /// update the (master) nodes whose position depends on the perturbed
+    /// Data item, rather than performing a full node update of the
+    /// element after every perturbation. Must not be used for elements
+    /// that overload node_update() to perform additional operations
+    /// (e.g. updates of an associated bulk element).
+    void enable_selective_node_update_during_fd()
+    {
+      Selective_node_update_during_fd = true;
+    }
+
+    /// \short Perform a full node update of the element after every
+    /// perturbation of the geometric data (default)
+    void disable_selective_node_update_during_fd()
+    {
+      Selective_node_update_during_fd = false;
+    }
+
+    /// \short Test whether only the nodes affected by a given geometric
+    /// Data item are updated during finite-differencing
+    bool is_selective_node_update_during_fd_enabled() const
+    {
+      return Selective_node_update_during_fd;
+    }
+
   protected:
     /// \short Compute derivatives of the nodal coordinates w.r.t.
     /// to the geometric dofs. Default implementation by FD can be overwritten
@@ -303,9 +329,17 @@ namespace oomph
     virtual void get_dnodal_coordinates_dgeom_dofs(
       RankThreeTensor<double>& dnodal_coordinates_dgeom_dofs);
 
-    /// Construct the vector of (unique) geometric data
+    /// Construct the vector of (unique) geometric data and the
+    /// lookup scheme for the (master) nodes that are affected by each
+    /// of them
     void complete_setup_of_dependencies();
 
+    /// \short Update the position of the nodes that are affected by
+    /// the i-th geometric Data item. Only updates the relevant (master)
+    /// nodes if selective node updates are enabled; otherwise the entire
+    /// element is updated.
+    void node_update_for_geom_data(const unsigned& i);
+
     /// Assign local equation numbers for the geometric Data in the element
     /// If the boolean argument is true then the degrees of freedom are stored
     /// in Dof_pt
@@ -375,6 +409,15 @@ namespace oomph
     /// \short Choose method for evaluation of shape derivatives
     /// (this takes one of the values in the enumeration)
     int Method_for_shape_derivs;
+
+    /// \short Boolean flag to indicate that only the nodes that are
+    /// affected by a perturbed geometric Data item are updated during
+    /// the finite-difference evaluation of the shape derivatives
+    bool Selective_node_update_during_fd;
+
+    /// \short Geom_data_dependent_node_pt[i] contains the (master) nodes
+    /// whose position depends on the i-th geometric Data item
+    Vector<Vector<Node*>> Geom_data_dependent_node_pt;
   };
 
 
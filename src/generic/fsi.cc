@@ -263,6 +263,22 @@ namespace oomph
   }
 
 
+  //==================================================================
+  /// Update the nodal positions in the specified subset of the fluid
+  /// elements that affect the traction on this FSIWallElement (typically
+  /// the ones that are affected by a specific external interaction datum)
+  //==================================================================
+  void FSIWallElement::node_update_adjacent_fluid_elements(
+    const Vector<FiniteElement*>& fluid_element_pt)
+  {
+    const unsigned n_el = fluid_element_pt.size();
+    for (unsigned e = 0; e < n_el; e++)
+    {
+      fluid_element_pt[e]->node_update();
+    }
+  }
+
+
   //=================================================================
   /// Static default value for the ratio of stress scales
   /// used in the fluid and solid equations (default is 1.0)
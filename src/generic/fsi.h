@@ -328,6 +328,11 @@ namespace oomph
     /// the traction on this FSIWallElement
     void node_update_adjacent_fluid_elements();
 
+    /// \short Update the nodal positions in the specified subset of the
+    /// fluid elements that affect the traction on this FSIWallElement
+    void node_update_adjacent_fluid_elements(
+      const Vector<FiniteElement*>& fluid_element_pt);
+
 
     /// Fill in the element's contribution to the Jacobian matrix
     /// and the residual vector: Done by finite differencing the
@@ -425,17 +430,27 @@ namespace oomph
       }
     }
 
-    /// \short After an external field data change, update the nodal positions
+    /// \short After an external field data change, update the nodal
+    /// positions in the fluid elements that are affected by the change
     inline void update_in_external_interaction_field_fd(const unsigned& i)
     {
       if (!Ignore_shear_stress_in_jacobian)
       {
-        node_update_adjacent_fluid_elements();
+        node_update_adjacent_fluid_elements(
+          external_elements_affected_by_field_data(i));
       }
     }
 
-    // Do nothing
-    inline void reset_in_external_interaction_field_fd(const unsigned& i) {}
+    /// \short After the reset of an external field datum, reset the
+    /// nodal positions in the fluid elements that were affected by it
+    inline void reset_in_external_interaction_field_fd(const unsigned& i)
+    {
+      if (!Ignore_shear_stress_in_jacobian)
+      {
+        node_update_adjacent_fluid_elements(
+          external_elements_affected_by_field_data(i));
+      }
+    }
 
     // After all external field stuff reset
     inline void reset_after_external_interaction_field_fd()
@@ -448,17 +463,26 @@ namespace oomph
 
 
     /// \short After an external geometric data change, update the nodal
-    /// positions
+    /// positions in the fluid elements whose geometry depends on it
     inline void update_in_external_interaction_geometric_fd(const unsigned& i)
     {
       if (!Ignore_shear_stress_in_jacobian)
       {
-        node_update_adjacent_fluid_elements();
+        node_update_adjacent_fluid_elements(
+          external_elements_affected_by_geometric_data(i));
       }
     }
 
-    // Do nothing
-    inline void reset_in_external_interaction_geometric_fd(const unsigned& i) {}
+    /// \short After the reset of an external geometric datum, reset the
+    /// nodal positions in the fluid elements whose geometry depends on it
+    inline void reset_in_external_interaction_geometric_fd(const unsigned& i)
+    {
+      if (!Ignore_shear_stress_in_jacobian)
+      {
+        node_update_adjacent_fluid_elements(
+          external_elements_affected_by_geometric_data(i));
+      }
+    }
 
     // After all external geometric stuff reset
     inline void reset_after_external_interaction_geometric_fd()
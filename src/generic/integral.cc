@@ -846,4 +846,208 @@ namespace oomph
     2.23873973961420164e-03,  2.23873973961420164e-03, 2.23873973961420164e-03,
     2.23873973961420164e-03,  2.23873973961420164e-03, 2.23873973961420164e-03};
 
+
+  ////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////
+
+
+  namespace IntegralHelper
+  {
+    //=================================================================
+    /// \short Gauss scheme for dim-dimensional QElements (line, quad or
+    /// brick elements) that integrates polynomials of the given order
+    /// (in each coordinate direction) exactly. An NPTS_1D-point Gauss
+    /// rule integrates polynomials of order 2*NPTS_1D-1 exactly.
+    //=================================================================
+    Integral* q_integral_pt(const unsigned& dim, const unsigned& order)
+    {
+      // The schemes (only built when first needed)
+      static Gauss<1, 2> gauss_1_2;
+      static Gauss<1, 3> gauss_1_3;
+      static Gauss<1, 4> gauss_1_4;
+      static Gauss<2, 2> gauss_2_2;
+      static Gauss<2, 3> gauss_2_3;
+      static Gauss<2, 4> gauss_2_4;
+      static Gauss<3, 2> gauss_3_2;
+      static Gauss<3, 3> gauss_3_3;
+      static Gauss<3, 4> gauss_3_4;
+
+      // Number of points in each direction required
+      unsigned npts_1d = (order + 2) / 2;
+      if (npts_1d < 2)
+      {
+        npts_1d = 2;
+      }
+
+      switch (dim)
+      {
+        case 1:
+          switch (npts_1d)
+          {
+            case 2:
+              return &gauss_1_2;
+            case 3:
+              return &gauss_1_3;
+            case 4:
+              return &gauss_1_4;
+            case 5:
+            {
+              static GaussLegendre<1, 5> gauss_legendre_1_5;
+              return &gauss_legendre_1_5;
+            }
+            case 6:
+            {
+              static GaussLegendre<1, 6> gauss_legendre_1_6;
+              return &gauss_legendre_1_6;
+            }
+          }
+          break;
+
+        case 2:
+          switch (npts_1d)
+          {
+            case 2:
+              return &gauss_2_2;
+            case 3:
+              return &gauss_2_3;
+            case 4:
+              return &gauss_2_4;
+            case 5:
+            {
+              static GaussLegendre<2, 5> gauss_legendre_2_5;
+              return &gauss_legendre_2_5;
+            }
+            case 6:
+            {
+              static GaussLegendre<2, 6> gauss_legendre_2_6;
+              return &gauss_legendre_2_6;
+            }
+          }
+          break;
+
+        case 3:
+          switch (npts_1d)
+          {
+            case 2:
+              return &gauss_3_2;
+            case 3:
+              return &gauss_3_3;
+            case 4:
+              return &gauss_3_4;
+            case 5:
+            {
+              static GaussLegendre<3, 5> gauss_legendre_3_5;
+              return &gauss_legendre_3_5;
+            }
+            case 6:
+            {
+              static GaussLegendre<3, 6> gauss_legendre_3_6;
+              return &gauss_legendre_3_6;
+            }
+          }
+          break;
+      }
+
+      std::ostringstream error_stream;
+      error_stream << "No Gauss scheme is available that integrates "
+                   << "polynomials of order " << order << "\n"
+                   << "exactly in a " << dim << "-dimensional QElement.\n"
+                   << "(dim must be 1, 2 or 3 and order no larger than 11)\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+
+
+    //=================================================================
+    /// \short Gauss scheme for dim-dimensional TElements (line,
+    /// triangle or tet elements) that integrates polynomials of the
+    /// given (total) order exactly.
+    //=================================================================
+    Integral* t_integral_pt(const unsigned& dim, const unsigned& order)
+    {
+      switch (dim)
+      {
+        case 1:
+          if (order <= 2)
+          {
+            static TGauss<1, 2> tgauss_1_2;
+            return &tgauss_1_2;
+          }
+          else if (order <= 5)
+          {
+            static TGauss<1, 3> tgauss_1_3;
+            return &tgauss_1_3;
+          }
+          else if (order <= 7)
+          {
+            static TGauss<1, 4> tgauss_1_4;
+            return &tgauss_1_4;
+          }
+          break;
+
+        case 2:
+          // 3, 7, 13, 19, 37 and 52 knots, respectively
+          if (order <= 2)
+          {
+            static TGauss<2, 2> tgauss_2_2;
+            return &tgauss_2_2;
+          }
+          else if (order <= 5)
+          {
+            static TGauss<2, 3> tgauss_2_3;
+            return &tgauss_2_3;
+          }
+          else if (order <= 7)
+          {
+            static TGauss<2, 4> tgauss_2_4;
+            return &tgauss_2_4;
+          }
+          else if (order <= 8)
+          {
+            static TGauss<2, 9> tgauss_2_9;
+            return &tgauss_2_9;
+          }
+          else if (order <= 11)
+          {
+            static TGauss<2, 13> tgauss_2_13;
+            return &tgauss_2_13;
+          }
+          else if (order <= 16)
+          {
+            static TGauss<2, 16> tgauss_2_16;
+            return &tgauss_2_16;
+          }
+          break;
+
+        case 3:
+          // 4, 11 and 45 knots, respectively
+          if (order <= 2)
+          {
+            static TGauss<3, 2> tgauss_3_2;
+            return &tgauss_3_2;
+          }
+          else if (order <= 4)
+          {
+            static TGauss<3, 3> tgauss_3_3;
+            return &tgauss_3_3;
+          }
+          else if (order <= 8)
+          {
+            static TGauss<3, 5> tgauss_3_5;
+            return &tgauss_3_5;
+          }
+          break;
+      }
+
+      std::ostringstream error_stream;
+      error_stream << "No Gauss scheme is available that integrates "
+                   << "polynomials of order " << order << "\n"
+                   << "exactly in a " << dim << "-dimensional TElement.\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+
+  } // namespace IntegralHelper
+
 } // namespace oomph
@@ -1835,6 +1835,40 @@ namespace oomph
   }
 
 
+  ////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////
+
+
+  //===================================================================
+  /// \short Helper functions that select the integration scheme with
+  /// the fewest knots (amongst those defined above) that integrates
+  /// polynomials up to a given order exactly. Here the order is the
+  /// polynomial degree of the complete integrand on an affine element,
+  /// i.e. including all products of (derivatives of) shape functions,
+  /// coefficients and source terms that appear in the weak form. The
+  /// helpers do not know the weak form: choosing an order that is
+  /// sufficient for the problem at hand (and that does not introduce
+  /// spurious zero-energy modes) is the caller's job. The schemes
+  /// can be assigned with Mesh::set_integration_scheme(...) and
+  /// assessed with Mesh::compare_integration_scheme(...).
+  /// The schemes returned are static objects; don't delete them.
+  //===================================================================
+  namespace IntegralHelper
+  {
+    /// \short Gauss scheme for dim-dimensional QElements (line, quad or
+    /// brick elements) that integrates polynomials of the given order
+    /// (in each coordinate direction) exactly.
+    extern Integral* q_integral_pt(const unsigned& dim, const unsigned& order);
+
+    /// \short Gauss scheme for dim-dimensional TElements (line,
+    /// triangle or tet elements) that integrates polynomials of the
+    /// given (total) order exactly.
+    extern Integral* t_integral_pt(const unsigned& dim, const unsigned& order);
+
+  } // namespace IntegralHelper
+
+
 } // namespace oomph
 
 #endif
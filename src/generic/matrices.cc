@@ -30,9 +30,12 @@
 #endif
 
 #include <cstring>
+#include <float.h>
 
 #include <set>
 #include <map>
+#include <list>
+#include <algorithm>
 
 //#include <valgrind/callgrind.h>
 
@@ -1222,9 +1225,9 @@ namespace oomph
     // set the serial matrix-matrix multiply method
 #ifdef OOMPH_HAS_TRILINOS
     //    Serial_matrix_matrix_multiply_method = 4;
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #else
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #endif
   }
 
@@ -1272,9 +1275,9 @@ namespace oomph
     // set the serial matrix-matrix multiply method
 #ifdef OOMPH_HAS_TRILINOS
     // Serial_matrix_matrix_multiply_method = 4;
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #else
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #endif
   }
 
@@ -1297,9 +1300,9 @@ namespace oomph
 // set the serial matrix-matrix multiply method
 #ifdef OOMPH_HAS_TRILINOS
     //    Serial_matrix_matrix_multiply_method = 4;
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #else
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #endif
   }
 
@@ -1327,9 +1330,9 @@ namespace oomph
     // set the serial matrix-matrix multiply method
 #ifdef OOMPH_HAS_TRILINOS
     // Serial_matrix_matrix_multiply_method = 4;
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #else
-    Serial_matrix_matrix_multiply_method = 2;
+    Serial_matrix_matrix_multiply_method = 6;
 #endif
 
     // matrix has been built
@@ -1971,7 +1974,8 @@ namespace oomph
 
   //===========================================================================
   /// Function to multiply this matrix by the CRDoubleMatrix matrix_in.
-  /// In a serial matrix, there are 4 methods available:
+  /// In a serial matrix, the method is selected with
+  /// serial_matrix_matrix_multiply_method(); there are 6 methods available:
   /// Method 1: First runs through this matrix and matrix_in to find the storage
   ///           requirements for result - arrays of the correct size are
   ///           then allocated before performing the calculation.
@@ -1984,8 +1988,19 @@ namespace oomph
   ///           on the platforms we tried...
   /// Method 4: Trilinos Epetra Matrix Matrix multiply.
   /// Method 5: Trilinox Epetra Matrix Matrix Mulitply (ml based)
-  /// If Trilinos is installed then Method 4 is employed by default, otherwise
-  /// Method 2 is employed by default.
+  /// Method 6: Two-phase product: the sparsity pattern of result is computed
+  ///           first (symbolic phase, see
+  ///           CRDoubleMatrixHelpers::symbolic_matrix_matrix_product(...))
+  ///           and the values are then accumulated directly into the final
+  ///           storage. Method 6 is employed by default (with or without
+  ///           Trilinos).
+  /// The symbolic phase of Method 6 can be cached: setting
+  /// CRDoubleMatrixHelpers::Max_n_cached_symbolic_matrix_matrix_products
+  /// to a positive number keeps the sparsity patterns of that many recent
+  /// products. A cached pattern is only reused if the sparsity patterns of
+  /// both factors agree with the cached copies, so the cache never has to
+  /// be invalidated when the matrices change. To free the memory it uses,
+  /// call CRDoubleMatrixHelpers::clear_symbolic_matrix_matrix_product_cache().
   /// In a distributed matrix, only Trilinos Epetra Matrix Matrix multiply
   /// is available.
   //=============================================================================
@@ -2038,7 +2053,7 @@ namespace oomph
 
     // if this matrix is not distributed and matrix in is not distributed
     if (!this->distributed() && !matrix_in.distributed() &&
-        ((method == 1) || (method == 2) || (method == 3)))
+        ((method == 1) || (method == 2) || (method == 3) || (method == 6)))
     {
       // NB N is number of rows!
       unsigned long N = this->nrow();
@@ -2329,6 +2344,69 @@ namespace oomph
         }
       }
 
+      // METHOD 6
+      // --------
+      else if (method == 6)
+      {
+        // Symbolic phase: get the sparsity pattern of the result
+        Vector<int> result_row_start;
+        Vector<int> result_column_index;
+        CRDoubleMatrixHelpers::symbolic_matrix_matrix_product(
+          *this, matrix_in, result_row_start, result_column_index);
+
+        // set Nnz
+        Nnz = result_row_start[N];
+
+        // allocate arrays for result and copy the sparsity pattern across
+        Row_start = new int[N + 1];
+        Column_index = new int[Nnz];
+        Value = new double[Nnz];
+        std::copy(result_row_start.begin(), result_row_start.end(), Row_start);
+        std::copy(
+          result_column_index.begin(), result_column_index.end(), Column_index);
+
+        // Numeric phase: position[col] is the index of the entry in column
+        // col in the row of result that is currently being assembled.
+        // [Entries left over from previous rows are never accessed because
+        // the pattern of the current row contains all its columns.]
+        Vector<int> position(M, -1);
+
+        // run through rows of this matrix
+        for (unsigned long this_row = 0; this_row < N; this_row++)
+        {
+          // initialise the entries in this row of result
+          for (int ptr = Row_start[this_row];
+               ptr < Row_start[this_row + 1];
+               ptr++)
+          {
+            position[Column_index[ptr]] = ptr;
+            Value[ptr] = 0.0;
+          }
+
+          // run through non-zeros in this_row
+          for (int this_ptr = this_row_start[this_row];
+               this_ptr < this_row_start[this_row + 1];
+               this_ptr++)
+          {
+            // find value of non-zero
+            double this_val = this_value[this_ptr];
+
+            // find column index associated with non-zero
+            int matrix_in_row = this_column_index[this_ptr];
+
+            // run through corresponding row in matrix_in and add
+            // contributions
+            for (int matrix_in_ptr = matrix_in_row_start[matrix_in_row];
+                 matrix_in_ptr < matrix_in_row_start[matrix_in_row + 1];
+                 matrix_in_ptr++)
+            {
+              Value[position[matrix_in_column_index[matrix_in_ptr]]] +=
+                this_val * matrix_in_value[matrix_in_ptr];
+            }
+          }
+        }
+      }
+
       // build
       result.build_without_copy(M, Nnz, Value, Column_index, Row_start);
     }
@@ -3981,6 +4059,278 @@ namespace oomph
       return inf_norm;
     }
 
+    /// \short Max. number of sparsity patterns of matrix-matrix products
+    /// that are cached (0: no caching)
+    unsigned Max_n_cached_symbolic_matrix_matrix_products = 0;
+
+    //============================================================================
+    /// Sparsity patterns of the two factors and of the result of a
+    /// (serial) matrix-matrix product, as stored in the cache used by
+    /// symbolic_matrix_matrix_product(...)
+    //============================================================================
+    class CachedSymbolicMatrixMatrixProduct
+    {
+    public:
+      /// Number of columns of the second factor (and the result)
+      unsigned long Ncol_b;
+
+      /// Row starts of the first factor
+      Vector<int> Row_start_a;
+
+      /// Column indices of the first factor
+      Vector<int> Column_index_a;
+
+      /// Row starts of the second factor
+      Vector<int> Row_start_b;
+
+      /// Column indices of the second factor
+      Vector<int> Column_index_b;
+
+      /// Row starts of the result
+      Vector<int> Result_row_start;
+
+      /// Column indices of the result
+      Vector<int> Result_column_index;
+    };
+
+    /// \short Cache of sparsity patterns of matrix-matrix products (most
+    /// recently used first)
+    std::list<CachedSymbolicMatrixMatrixProduct>
+      Symbolic_matrix_matrix_product_cache;
+
+    //============================================================================
+    /// Wipe the cache of sparsity patterns of matrix-matrix products
+    //============================================================================
+    void clear_symbolic_matrix_matrix_product_cache()
+    {
+      Symbolic_matrix_matrix_product_cache.clear();
+    }
+
+    //============================================================================
+    /// Does the (local) sparsity pattern of matrix agree with the one
+    /// specified by row_start and column_index?
+    //============================================================================
+    bool sparsity_pattern_matches(const Vector<int>& row_start,
+                                  const Vector<int>& column_index,
+                                  const CRDoubleMatrix& matrix)
+    {
+      const unsigned long n_row = matrix.nrow_local();
+      const unsigned long n_nz = matrix.nnz();
+      if ((row_start.size() != n_row + 1) || (column_index.size() != n_nz))
+      {
+        return false;
+      }
+      return std::equal(
+               row_start.begin(), row_start.end(), matrix.row_start()) &&
+             std::equal(column_index.begin(),
+                        column_index.end(),
+                        matrix.column_index());
+    }
+
+    //============================================================================
+    /// Symbolic phase of the (serial) matrix-matrix product
+    /// matrix_a * matrix_b: compute the row starts and the (sorted) column
+    /// indices of the product, using the cache of sparsity patterns if
+    /// Max_n_cached_symbolic_matrix_matrix_products > 0.
+    //============================================================================
+    void symbolic_matrix_matrix_product(const CRDoubleMatrix& matrix_a,
+                                        const CRDoubleMatrix& matrix_b,
+                                        Vector<int>& result_row_start,
+                                        Vector<int>& result_column_index)
+    {
+      const unsigned long n_row = matrix_a.nrow_local();
+      const unsigned long n_col = matrix_b.ncol();
+
+      // Have we formed a product with the same sparsity patterns before?
+      if (Max_n_cached_symbolic_matrix_matrix_products > 0)
+      {
+        for (std::list<CachedSymbolicMatrixMatrixProduct>::iterator it =
+               Symbolic_matrix_matrix_product_cache.begin();
+             it != Symbolic_matrix_matrix_product_cache.end();
+             it++)
+        {
+          if ((it->Ncol_b == n_col) &&
+              sparsity_pattern_matches(
+                it->Row_start_a, it->Column_index_a, matrix_a) &&
+              sparsity_pattern_matches(
+                it->Row_start_b, it->Column_index_b, matrix_b))
+          {
+            result_row_start = it->Result_row_start;
+            result_column_index = it->Result_column_index;
+
+            // Move to the front of the cache
+            Symbolic_matrix_matrix_product_cache.splice(
+              Symbolic_matrix_matrix_product_cache.begin(),
+              Symbolic_matrix_matrix_product_cache,
+              it);
+            return;
+          }
+        }
+      }
+
+      // get pointers to the sparsity patterns of the two factors
+      const int* row_start_a = matrix_a.row_start();
+      const int* column_index_a = matrix_a.column_index();
+      const int* row_start_b = matrix_b.row_start();
+      const int* column_index_b = matrix_b.column_index();
+
+      // marker[col] is the last row of the result in which column col
+      // was encountered
+      Vector<long> marker(n_col, -1);
+
+      result_row_start.resize(n_row + 1);
+      result_row_start[0] = 0;
+      result_column_index.clear();
+      result_column_index.reserve(matrix_a.nnz() + matrix_b.nnz());
+
+      // run through rows of matrix_a
+      for (unsigned long row = 0; row < n_row; row++)
+      {
+        for (int ptr_a = row_start_a[row];
+             ptr_a < row_start_a[row + 1];
+             ptr_a++)
+        {
+          // run through the corresponding row of matrix_b
+          int row_b = column_index_a[ptr_a];
+          for (int ptr_b = row_start_b[row_b];
+               ptr_b < row_start_b[row_b + 1];
+               ptr_b++)
+          {
+            int col = column_index_b[ptr_b];
+            if (marker[col] != long(row))
+            {
+              marker[col] = row;
+              result_column_index.push_back(col);
+            }
+          }
+        }
+
+        // Sort the column indices in this row
+        std::sort(result_column_index.begin() + result_row_start[row],
+                  result_column_index.end());
+        result_row_start[row + 1] = result_column_index.size();
+      }
+
+      // Add to the cache, dropping the least recently used entries
+      if (Max_n_cached_symbolic_matrix_matrix_products > 0)
+      {
+        Symbolic_matrix_matrix_product_cache.push_front(
+          CachedSymbolicMatrixMatrixProduct());
+        CachedSymbolicMatrixMatrixProduct& cached =
+          Symbolic_matrix_matrix_product_cache.front();
+        cached.Ncol_b = n_col;
+        cached.Row_start_a.assign(row_start_a, row_start_a + n_row + 1);
+        cached.Column_index_a.assign(column_index_a,
+                                     column_index_a + matrix_a.nnz());
+        cached.Row_start_b.assign(row_start_b,
+                                  row_start_b + matrix_b.nrow_local() + 1);
+        cached.Column_index_b.assign(column_index_b,
+                                     column_index_b + matrix_b.nnz());
+        cached.Result_row_start = result_row_start;
+        cached.Result_column_index = result_column_index;
+        while (Symbolic_matrix_matrix_product_cache.size() >
+               Max_n_cached_symbolic_matrix_matrix_products)
+        {
+          Symbolic_matrix_matrix_product_cache.pop_back();
+        }
+      }
+    }
+
+    //============================================================================
+    /// Relative change (in the Frobenius norm) of matrix with respect to
+    /// old_matrix. Returns DBL_MAX if the matrices do not have the same
+    /// distribution and sparsity pattern.
+    //============================================================================
+    double relative_frobenius_change(const CRDoubleMatrix& matrix,
+                                     const CRDoubleMatrix& old_matrix)
+    {
+      // Can't compare matrices that haven't been built
+      if ((!matrix.built()) || (!old_matrix.built()))
+      {
+        return DBL_MAX;
+      }
+
+      // Check the (local) sparsity patterns are the same
+      unsigned same_pattern = 1;
+      const unsigned nrow_local = matrix.nrow_local();
+      const unsigned long nnz_local = matrix.nnz();
+      if ((matrix.ncol() != old_matrix.ncol()) ||
+          (*matrix.distribution_pt() != *old_matrix.distribution_pt()) ||
+          (nnz_local != old_matrix.nnz()))
+      {
+        same_pattern = 0;
+      }
+      else
+      {
+        const int* row_start = matrix.row_start();
+        const int* old_row_start = old_matrix.row_start();
+        for (unsigned i = 0; i <= nrow_local; i++)
+        {
+          if (row_start[i] != old_row_start[i])
+          {
+            same_pattern = 0;
+            break;
+          }
+        }
+        const int* column_index = matrix.column_index();
+        const int* old_column_index = old_matrix.column_index();
+        for (unsigned long k = 0; (k < nnz_local) && same_pattern; k++)
+        {
+          if (column_index[k] != old_column_index[k])
+          {
+            same_pattern = 0;
+          }
+        }
+      }
+
+      // Accumulate the squared norms of the difference and the old matrix
+      double sums[2] = {0.0, 0.0};
+      if (same_pattern)
+      {
+        const double* value = matrix.value();
+        const double* old_value = old_matrix.value();
+        for (unsigned long k = 0; k < nnz_local; k++)
+        {
+          double diff = value[k] - old_value[k];
+          sums[0] += diff * diff;
+          sums[1] += old_value[k] * old_value[k];
+        }
+      }
+
+      // If the matrices are distributed, combine over all processors
+#ifdef OOMPH_HAS_MPI
+      const OomphCommunicator* const comm_pt =
+        matrix.distribution_pt()->communicator_pt();
+      if (matrix.distributed() && comm_pt->nproc() > 1)
+      {
+        unsigned local_same_pattern = same_pattern;
+        MPI_Allreduce(&local_same_pattern,
+                      &same_pattern,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_MIN,
+                      comm_pt->mpi_comm());
+        double local_sums[2] = {sums[0], sums[1]};
+        MPI_Allreduce(
+          local_sums, sums, 2, MPI_DOUBLE, MPI_SUM, comm_pt->mpi_comm());
+      }
+#endif
+
+      // Not comparable
+      if (!same_pattern)
+      {
+        return DBL_MAX;
+      }
+
+      // Old matrix was zero: any change is infinitely large (unless there
+      // wasn't any)
+      if (sums[1] == 0.0)
+      {
+        return (sums[0] == 0.0) ? 0.0 : DBL_MAX;
+      }
+      return sqrt(sums[0] / sums[1]);
+    }
+
     //============================================================================
     /// \short Calculates the largest Gershgorin disc whilst preserving the
     /// sign. Let A be an n by n matrix, with entries aij. For \f$ i \in \{
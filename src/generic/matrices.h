@@ -1177,6 +1177,11 @@ namespace oomph
     ///           on the platforms we tried...
     /// Method 4: Trilinos Epetra Matrix Matrix multiply.
     /// Method 5: Trilinos Epetra Matrix Matrix multiply (ML based).
+    /// Method 6: Two-phase product: the sparsity pattern of result is
+    ///           computed first (or recovered from the cache maintained by
+    ///           CRDoubleMatrixHelpers::symbolic_matrix_matrix_product(...))
+    ///           and the values are then accumulated directly into
+    ///           the final storage. Fastest; default.
     unsigned& serial_matrix_matrix_multiply_method()
     {
       return Serial_matrix_matrix_multiply_method;
@@ -1199,6 +1204,11 @@ namespace oomph
     ///           on the platforms we tried...
     /// Method 4: Trilinos Epetra Matrix Matrix multiply.
     /// Method 5: Trilinos Epetra Matrix Matrix multiply (ML based).
+    /// Method 6: Two-phase product: the sparsity pattern of result is
+    ///           computed first (or recovered from the cache maintained by
+    ///           CRDoubleMatrixHelpers::symbolic_matrix_matrix_product(...))
+    ///           and the values are then accumulated directly into
+    ///           the final storage. Fastest; default.
     const unsigned& serial_matrix_matrix_multiply_method() const
     {
       return Serial_matrix_matrix_multiply_method;
@@ -3627,6 +3637,36 @@ namespace oomph
     /// the infinity norm.
     double inf_norm(const DenseMatrix<CRDoubleMatrix*>& matrix_pt);
 
+    /// \short Relative change (in the Frobenius norm) of matrix with respect
+    /// to old_matrix, i.e. ||matrix - old_matrix||_F / ||old_matrix||_F.
+    /// Used to decide whether (expensive) preconditioners set up for
+    /// old_matrix can be re-used for matrix. Returns DBL_MAX if the
+    /// matrices do not have the same distribution and sparsity pattern
+    /// (so the entries cannot be compared directly).
+    double relative_frobenius_change(const CRDoubleMatrix& matrix,
+                                     const CRDoubleMatrix& old_matrix);
+
+    /// \short Max. number of sparsity patterns of (serial) matrix-matrix
+    /// products that are cached by symbolic_matrix_matrix_product(...),
+    /// so the symbolic phase can be skipped when a product of matrices with
+    /// the same sparsity patterns is formed again (e.g. during repeated
+    /// setups of Schur complement approximations). Defaults to 0
+    /// (no caching) since the cache stores copies of the sparsity
+    /// patterns of both factors and of the product.
+    extern unsigned Max_n_cached_symbolic_matrix_matrix_products;
+
+    /// \short Wipe the cache of sparsity patterns of matrix-matrix products
+    void clear_symbolic_matrix_matrix_product_cache();
+
+    /// \short Symbolic phase of the (serial) matrix-matrix product
+    /// matrix_a * matrix_b: compute the row starts and the (sorted) column
+    /// indices of the product. Uses (and updates) the cache of sparsity
+    /// patterns if Max_n_cached_symbolic_matrix_matrix_products > 0.
+    void symbolic_matrix_matrix_product(const CRDoubleMatrix& matrix_a,
+                                        const CRDoubleMatrix& matrix_b,
+                                        Vector<int>& result_row_start,
+                                        Vector<int>& result_column_index);
+
     /// \short Calculates the largest Gershgorin disc whilst preserving the
     /// sign. Let A be an n by n matrix, with entries aij. For \f$ i \in \{
     /// 1,...,n \} \f$ let \f$ R_i = \sum_{i\neq j}|a_{ij}| \f$ be the sum of
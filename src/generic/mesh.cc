@@ -958,6 +958,202 @@ namespace oomph
   }
 
 
+  //========================================================
+  /// Assign the spatial integration scheme pointed to by
+  /// integral_pt to all finite elements in the mesh.
+  //========================================================
+  void Mesh::set_integration_scheme(Integral* const& integral_pt)
+  {
+    unsigned nelem = nelement();
+    for (unsigned e = 0; e < nelem; e++)
+    {
+      FiniteElement* el_pt = finite_element_pt(e);
+      if (el_pt != 0)
+      {
+        el_pt->set_integration_scheme(integral_pt);
+      }
+    }
+  }
+
+
+  //========================================================
+  /// Assess the effect of replacing the elements' current
+  /// integration schemes by the one pointed to by integral_pt.
+  /// Returns the maximum difference between the entries in the
+  /// elements' residual vectors and Jacobian matrices, relative
+  /// to the largest entry computed with the current schemes.
+  //========================================================
+  double Mesh::compare_integration_scheme(Integral* const& integral_pt)
+  {
+    // Maximum (absolute) entry and difference
+    double max_entry = 0.0;
+    double max_diff = 0.0;
+
+    // Total number of knots and assembly times for both schemes
+    unsigned long n_knot_current = 0;
+    unsigned long n_knot_new = 0;
+    double t_current = 0.0;
+    double t_new = 0.0;
+
+    unsigned nelem = nelement();
+    for (unsigned e = 0; e < nelem; e++)
+    {
+      FiniteElement* el_pt = finite_element_pt(e);
+
+      // Only consider finite elements that contribute something
+      if (el_pt == 0) continue;
+      unsigned n_dof = el_pt->ndof();
+      if (n_dof == 0) continue;
+
+      // Residuals and Jacobian with the current scheme
+      Integral* current_integral_pt = el_pt->integral_pt();
+      Vector<double> residuals_current(n_dof);
+      DenseMatrix<double> jacobian_current(n_dof);
+      double t_start = TimingHelpers::timer();
+      el_pt->get_jacobian(residuals_current, jacobian_current);
+      t_current += TimingHelpers::timer() - t_start;
+      n_knot_current += current_integral_pt->nweight();
+
+      // ...and with the new one
+      el_pt->set_integration_scheme(integral_pt);
+      Vector<double> residuals_new(n_dof);
+      DenseMatrix<double> jacobian_new(n_dof);
+      t_start = TimingHelpers::timer();
+      el_pt->get_jacobian(residuals_new, jacobian_new);
+      t_new += TimingHelpers::timer() - t_start;
+      n_knot_new += integral_pt->nweight();
+
+      // Restore the original scheme
+      el_pt->set_integration_scheme(current_integral_pt);
+
+      // Compare
+      for (unsigned i = 0; i < n_dof; i++)
+      {
+        max_entry = std::max(max_entry, std::fabs(residuals_current[i]));
+        max_diff = std::max(
+          max_diff, std::fabs(residuals_new[i] - residuals_current[i]));
+        for (unsigned j = 0; j < n_dof; j++)
+        {
+          max_entry = std::max(max_entry, std::fabs(jacobian_current(i, j)));
+          max_diff = std::max(
+            max_diff, std::fabs(jacobian_new(i, j) - jacobian_current(i, j)));
+        }
+      }
+    }
+
+    // Relative difference
+    double rel_diff = max_diff;
+    if (max_entry > 0.0)
+    {
+      rel_diff /= max_entry;
+    }
+
+    oomph_info << "Comparison of integration schemes: " << n_knot_current
+               << " knots (current) vs. " << n_knot_new << " knots (new)\n"
+               << "Time for elemental residuals and Jacobians: " << t_current
+               << " sec (current) vs. " << t_new << " sec (new)\n"
+               << "Max. relative difference in the entries: " << rel_diff
+               << std::endl;
+
+    return rel_diff;
+  }
+
+
+  //========================================================
+  /// Partition the elements into colours such that no two
+  /// elements of the same colour share a node or a global
+  /// equation number. Greedy colouring in which each element
+  /// is given the admissible colour that currently holds the
+  /// fewest elements.
+  //========================================================
+  void Mesh::colour_elements()
+  {
+    Coloured_element_pt.clear();
+
+    // Colours of the elements that have already been coloured and that
+    // share the given node or global equation number
+    std::map<Node*, Vector<unsigned>> colours_at_node;
+    std::map<unsigned long, Vector<unsigned>> colours_at_eqn;
+
+    // Flags for colours that are used by the element's neighbours
+    std::vector<bool> colour_is_taken;
+
+    unsigned long nelem = nelement();
+    for (unsigned long e = 0; e < nelem; e++)
+    {
+      GeneralisedElement* el_pt = Element_pt[e];
+
+      // Collect the colours of all previously coloured elements that
+      // share nodes or global equations with this one
+      unsigned n_colour = Coloured_element_pt.size();
+      colour_is_taken.assign(n_colour, false);
+      FiniteElement* fe_pt = dynamic_cast<FiniteElement*>(el_pt);
+      unsigned n_node = 0;
+      if (fe_pt != 0)
+      {
+        n_node = fe_pt->nnode();
+      }
+      for (unsigned j = 0; j < n_node; j++)
+      {
+        Vector<unsigned>& colours = colours_at_node[fe_pt->node_pt(j)];
+        unsigned n = colours.size();
+        for (unsigned i = 0; i < n; i++)
+        {
+          colour_is_taken[colours[i]] = true;
+        }
+      }
+      unsigned n_dof = el_pt->ndof();
+      for (unsigned l = 0; l < n_dof; l++)
+      {
+        Vector<unsigned>& colours = colours_at_eqn[el_pt->eqn_number(l)];
+        unsigned n = colours.size();
+        for (unsigned i = 0; i < n; i++)
+        {
+          colour_is_taken[colours[i]] = true;
+        }
+      }
+
+      // Pick the admissible colour with the fewest elements (or start
+      // a new one)
+      unsigned colour = n_colour;
+      for (unsigned c = 0; c < n_colour; c++)
+      {
+        if ((!colour_is_taken[c]) &&
+            ((colour == n_colour) || (Coloured_element_pt[c].size() <
+                                      Coloured_element_pt[colour].size())))
+        {
+          colour = c;
+        }
+      }
+      if (colour == n_colour)
+      {
+        Coloured_element_pt.resize(n_colour + 1);
+      }
+      Coloured_element_pt[colour].push_back(el_pt);
+
+      // Record the colour for the element's nodes and equations
+      for (unsigned j = 0; j < n_node; j++)
+      {
+        Vector<unsigned>& colours = colours_at_node[fe_pt->node_pt(j)];
+        if (colours.empty() || (colours.back() != colour))
+        {
+          colours.push_back(colour);
+        }
+      }
+      for (unsigned l = 0; l < n_dof; l++)
+      {
+        Vector<unsigned>& colours = colours_at_eqn[el_pt->eqn_number(l)];
+        if (colours.empty() || (colours.back() != colour))
+        {
+          colours.push_back(colour);
+        }
+      }
+    }
+
+    Ncoloured_element = nelem;
+  }
+
+
   //========================================================
   /// Nodes that have been marked as obsolete are removed
   /// from the mesh and the its boundaries. Returns vector
@@ -185,6 +185,15 @@ namespace oomph
     /// Vector of pointers to generalised elements
     Vector<GeneralisedElement*> Element_pt;
 
+    /// \short Element colouring: Coloured_element_pt[c] stores pointers to
+    /// the elements of colour c (empty if the colouring hasn't been set
+    /// up or has been flushed). See colour_elements().
+    Vector<Vector<GeneralisedElement*>> Coloured_element_pt;
+
+    /// \short Number of elements in the mesh when the element colouring
+    /// was set up (used to detect colourings that are out of date)
+    unsigned long Ncoloured_element;
+
     /// \short Vector of boolean data that indicates whether the boundary
     /// coordinates have been set for the boundary
     std::vector<bool> Boundary_coordinate_exists;
@@ -237,6 +246,8 @@ namespace oomph
     {
       // Lookup scheme hasn't been setup yet
       Lookup_for_elements_next_boundary_is_setup = false;
+      // Elements haven't been coloured yet
+      Ncoloured_element = 0;
 #ifdef OOMPH_HAS_MPI
       // Set defaults for distributed meshes
 
@@ -256,6 +267,8 @@ namespace oomph
     /// duplicates; no boundary information etc. is created).
     Mesh(const Vector<Mesh*>& sub_mesh_pt)
     {
+      // Elements haven't been coloured yet
+      Ncoloured_element = 0;
 #ifdef OOMPH_HAS_MPI
       // Mesh hasn't been distributed: Null out pointer to communicator
       Comm_pt = 0;
@@ -430,6 +443,7 @@ namespace oomph
     void flush_element_storage()
     {
       Element_pt.clear();
+      flush_element_colouring();
     }
 
     /// \short Flush storage for nodes (only) by emptying the
@@ -754,6 +768,75 @@ namespace oomph
     }
 
 
+    /// \short Assign the spatial integration scheme pointed to by
+    /// integral_pt to all finite elements in the mesh (so meshes
+    /// representing different blocks of elements can use different
+    /// schemes). The integration scheme is not owned by the elements
+    /// and must outlive them; see IntegralHelper for a selection of
+    /// (static) schemes.
+    void set_integration_scheme(Integral* const& integral_pt);
+
+    /// \short Assess the effect of replacing the elements' current
+    /// integration schemes by the one pointed to by integral_pt: For
+    /// each finite element with dofs, the residuals and Jacobian are
+    /// computed with both schemes (the current scheme is restored
+    /// afterwards). The total number of knots and the assembly times
+    /// for both schemes are documented and the function returns the
+    /// maximum difference between the entries, relative to the largest
+    /// entry computed with the current schemes.
+    double compare_integration_scheme(Integral* const& integral_pt);
+
+    /// \short Partition the elements into colours such that no two
+    /// elements of the same colour share a node or a global equation
+    /// number. Elements of the same colour can therefore be processed
+    /// concurrently (e.g. during assembly, error estimation or projection)
+    /// without any conflicts when adding their contributions to shared
+    /// global structures. The colouring is greedy; each element is given
+    /// the admissible colour that currently holds the fewest elements so
+    /// the colours are of similar size. The colouring is cached and
+    /// flushed by Problem::assign_eqn_numbers(...), i.e. it is rebuilt
+    /// (on demand) after mesh adaptation.
+    void colour_elements();
+
+    /// \short Flush the element colouring (it is rebuilt when it is
+    /// next required)
+    void flush_element_colouring()
+    {
+      Coloured_element_pt.clear();
+      Ncoloured_element = 0;
+    }
+
+    /// \short Number of element colours. (Re-)builds the colouring if it
+    /// hasn't been set up or if the number of elements has changed.
+    unsigned ncolour()
+    {
+      if (Ncoloured_element != nelement() || Coloured_element_pt.empty())
+      {
+        colour_elements();
+      }
+      return Coloured_element_pt.size();
+    }
+
+    /// \short Vector of pointers to the elements of colour c. Call
+    /// ncolour() first to ensure that the colouring is up to date.
+    const Vector<GeneralisedElement*>& coloured_element_pt(
+      const unsigned& c) const
+    {
+#ifdef PARANOID
+      if (c >= Coloured_element_pt.size())
+      {
+        std::ostringstream error_stream;
+        error_stream << "Colour " << c << " does not exist; there are only "
+                     << Coloured_element_pt.size() << " colours.\n"
+                     << "Call ncolour() to set up the element colouring.\n";
+        throw OomphLibError(
+          error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+      }
+#endif
+      return Coloured_element_pt[c];
+    }
+
+
     /// \short Check for repeated nodes within a given spatial tolerance.
     /// Return (0/1) for (pass/fail).
     unsigned check_for_repeated_nodes(const double& epsilon = 1.0e-12)
@@ -67,6 +67,39 @@ namespace oomph
     /// elements over and over again when we go around the spirals.
     Vector<Vector<unsigned>> External_element_located;
 
+    /// \short Boolean to indicate that the external elements (and the
+    /// local coordinates within them) that were assigned during the previous
+    /// multi-domain setup should be tried first, before the full
+    /// (bin-based) search is performed. Defaults to false.
+    bool Use_previous_external_element_as_initial_guess = false;
+
+    /// \short External elements assigned during the previous multi-domain
+    /// setup (in the same flat-packed element ordering as
+    /// External_element_located)
+    Vector<Vector<FiniteElement*>> Previous_external_element_pt;
+
+    /// \short Local coordinates in the external elements assigned during
+    /// the previous multi-domain setup
+    Vector<Vector<Vector<double>>> Previous_external_element_local_coord;
+
+    /// \short Elements of the external meshes at the end of the last
+    /// multi-domain setup in which they were used, for each combination of
+    /// external mesh, interaction index and meshes containing the
+    /// ElementWithExternalElements. Used to decide whether the external
+    /// elements assigned during that setup may be used as initial guesses.
+    std::map<std::pair<std::pair<Mesh*, unsigned>, std::vector<Mesh*>>,
+             Vector<GeneralisedElement*>>
+      External_mesh_element_pt_at_last_setup;
+
+    //=====================================================================
+    /// Wipe the record of the external meshes used in previous
+    /// multi-domain setups
+    //=====================================================================
+    void invalidate_previous_external_elements()
+    {
+      External_mesh_element_pt_at_last_setup.clear();
+    }
+
     /// \short Vector of flat-packed zeta coordinates for which the external
     /// element could not be found during current local search. These
     /// will be sent to the next processor in the ring-like parallel search.
@@ -154,6 +187,26 @@ namespace oomph
     /// stage. Default set to true
     bool Allow_use_of_halo_elements_as_external_elements_for_projection = true;
 
+    /// \short Boolean to indicate that the bounding boxes (in zeta-space)
+    /// of the non-halo external elements on all processors should be
+    /// exchanged before the ring-based parallel search so that zetas
+    /// are only searched for (and the ring is only continued) where they
+    /// can possibly be located. Defaults to false.
+    bool Use_bounding_boxes_in_ring_search = false;
+
+    /// \short Padding applied to the bounding boxes used in the ring-based
+    /// search, as a fraction of their extent.
+    double Bounding_box_relative_padding = 0.1;
+
+    /// \short Tolerance added to the padding of all bounding boxes used in
+    /// the ring-based search, as a fraction of the largest extent of any
+    /// bounding box on any processor.
+    double Bounding_box_tolerance = 1.0e-8;
+
+    /// \short Flat-packed (padded) bounding boxes of the non-halo external
+    /// elements on all processors
+    Vector<double> Flat_packed_bounding_boxes;
+
     /// \short Boolean to indicate whether to doc timings or not.
     bool Doc_timings = false;
 
@@ -170,6 +223,208 @@ namespace oomph
     // Functions for location method in multi-domain problems
 
 
+    //========================================================================
+    /// Set up the (padded) bounding boxes, in zeta-space, of the non-halo
+    /// external elements in each of the meshes on the current process
+    /// and exchange them with all other processors.
+    //========================================================================
+    void setup_bounding_boxes_for_ring_search(
+      Problem* problem_pt, Vector<MeshAsGeomObject*>& mesh_geom_obj_pt)
+    {
+      // Number of meshes and processors
+      unsigned n_mesh = mesh_geom_obj_pt.size();
+      OomphCommunicator* comm_pt = problem_pt->communicator_pt();
+      int n_proc = comm_pt->nproc();
+
+      // Local bounding boxes (empty by default)
+      unsigned n_local = 2 * n_mesh * Dim;
+      Vector<double> local_bounding_boxes(n_local);
+      for (unsigned i = 0; i < n_mesh * Dim; i++)
+      {
+        local_bounding_boxes[2 * i] = DBL_MAX;
+        local_bounding_boxes[2 * i + 1] = -DBL_MAX;
+      }
+
+      // Sample the vertices of the elements (as in the setup of
+      // the sample point containers)
+      unsigned n_plot = 2;
+      Vector<double> s_local;
+      Vector<double> zeta_global(Dim);
+      for (unsigned i_mesh = 0; i_mesh < n_mesh; i_mesh++)
+      {
+        unsigned n_el = mesh_geom_obj_pt[i_mesh]->nelement();
+        for (unsigned e = 0; e < n_el; e++)
+        {
+          FiniteElement* el_pt = mesh_geom_obj_pt[i_mesh]->finite_element_pt(e);
+
+          // Only non-halo (source) elements can be accepted during the
+          // ring-based search
+          GeneralisedElement* source_el_pt = el_pt;
+          if (Use_bulk_element_as_external)
+          {
+            source_el_pt = dynamic_cast<FaceElement*>(el_pt)->bulk_element_pt();
+          }
+          if (source_el_pt->is_halo())
+          {
+            continue;
+          }
+
+          s_local.resize(el_pt->dim());
+          unsigned n_plot_points = el_pt->nplot_points(n_plot);
+          for (unsigned iplot = 0; iplot < n_plot_points; iplot++)
+          {
+            el_pt->get_s_plot(iplot, n_plot, s_local);
+            el_pt->interpolated_zeta(s_local, zeta_global);
+            for (unsigned i = 0; i < Dim; i++)
+            {
+              unsigned index = 2 * (i_mesh * Dim + i);
+              if (zeta_global[i] < local_bounding_boxes[index])
+              {
+                local_bounding_boxes[index] = zeta_global[i];
+              }
+              if (zeta_global[i] > local_bounding_boxes[index + 1])
+              {
+                local_bounding_boxes[index + 1] = zeta_global[i];
+              }
+            }
+          }
+        }
+      }
+
+      // Largest extent of the (non-empty) boxes over all directions and
+      // meshes, here and on any processor
+      double local_max_extent = 0.0;
+      for (unsigned i = 0; i < n_mesh * Dim; i++)
+      {
+        double extent =
+          local_bounding_boxes[2 * i + 1] - local_bounding_boxes[2 * i];
+        local_max_extent = std::max(local_max_extent, extent);
+      }
+      double global_max_extent = 0.0;
+      MPI_Allreduce(&local_max_extent,
+                    &global_max_extent,
+                    1,
+                    MPI_DOUBLE,
+                    MPI_MAX,
+                    comm_pt->mpi_comm());
+
+      // Tolerance added to all boxes. It must not vanish, even if all
+      // the boxes are degenerate (e.g. a single node, or face meshes on
+      // straight/planar boundaries), otherwise zetas that differ from the
+      // boxes' bounds by round-off would never be searched for.
+      double tolerance = Bounding_box_tolerance * global_max_extent;
+      if (tolerance == 0.0)
+      {
+        tolerance = Bounding_box_tolerance;
+      }
+
+      // Pad the (non-empty) boxes. Directions in which a box is thin (or
+      // degenerate) are padded relative to the box's largest extent,
+      // since the elements may be curved or slightly inclined relative
+      // to the coordinate directions.
+      for (unsigned i = 0; i < n_mesh * Dim; i++)
+      {
+        double extent =
+          local_bounding_boxes[2 * i + 1] - local_bounding_boxes[2 * i];
+        if (extent >= 0.0)
+        {
+          double padding =
+            Bounding_box_relative_padding * std::max(extent, local_max_extent) +
+            tolerance;
+          local_bounding_boxes[2 * i] -= padding;
+          local_bounding_boxes[2 * i + 1] += padding;
+        }
+      }
+
+      // Gather the boxes from all processors
+      Flat_packed_bounding_boxes.resize(n_proc * n_local);
+      MPI_Allgather(&local_bounding_boxes[0],
+                    n_local,
+                    MPI_DOUBLE,
+                    &Flat_packed_bounding_boxes[0],
+                    n_local,
+                    MPI_DOUBLE,
+                    comm_pt->mpi_comm());
+    }
+
+
+    //========================================================================
+    /// Is the zeta coordinate x_global contained in the bounding box
+    /// of mesh i_mesh (out of n_mesh) on processor proc?
+    //========================================================================
+    bool zeta_is_in_bounding_box(const int& proc,
+                                 const unsigned& i_mesh,
+                                 const unsigned& n_mesh,
+                                 const Vector<double>& x_global)
+    {
+      unsigned offset = 2 * (proc * n_mesh + i_mesh) * Dim;
+      for (unsigned i = 0; i < Dim; i++)
+      {
+        if ((x_global[i] < Flat_packed_bounding_boxes[offset + 2 * i]) ||
+            (x_global[i] > Flat_packed_bounding_boxes[offset + 2 * i + 1]))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    //========================================================================
+    /// Number of stages of the ring-based search that are required
+    /// (across all processors) so that each of the zetas in
+    /// Flat_packed_zetas_not_found_locally visits all processors whose
+    /// bounding boxes contain it. Zetas travel from processor my_rank
+    /// to processor my_rank+iproc during stage iproc.
+    //========================================================================
+    int nring_search_stage_required(Problem* problem_pt, const unsigned& n_mesh)
+    {
+      OomphCommunicator* comm_pt = problem_pt->communicator_pt();
+      int n_proc = comm_pt->nproc();
+      int my_rank = comm_pt->my_rank();
+
+      // Furthest stage required for the zetas missing on this processor
+      int local_n_stage = 0;
+      unsigned n_zeta = Flat_packed_zetas_not_found_locally.size() / Dim;
+      unsigned count = 0;
+      unsigned i_mesh = 0;
+      Vector<double> x_global(Dim);
+      for (unsigned i = 0; i < n_zeta; i++)
+      {
+        for (unsigned ii = 0; ii < Dim; ii++)
+        {
+          x_global[ii] = Flat_packed_zetas_not_found_locally[count];
+          count++;
+        }
+
+        // Padded entries mark the end of the current mesh
+        if (x_global[0] == DBL_MAX)
+        {
+          i_mesh++;
+          continue;
+        }
+
+        // Search backwards from the furthest processor; no need to
+        // look closer than what's already required
+        for (int iproc = n_proc - 1; iproc > local_n_stage; iproc--)
+        {
+          int proc = (my_rank + iproc) % n_proc;
+          if (zeta_is_in_bounding_box(proc, i_mesh, n_mesh, x_global))
+          {
+            local_n_stage = iproc;
+            break;
+          }
+        }
+      }
+
+      // Max over all processors
+      int n_stage = 0;
+      MPI_Allreduce(
+        &local_n_stage, &n_stage, 1, MPI_INT, MPI_MAX, comm_pt->mpi_comm());
+      return n_stage;
+    }
+
+
     //========================================================================
     /// Send the zeta coordinates from the current process to
     /// the next process; receive from the previous process
@@ -1905,7 +2160,14 @@ namespace oomph
         Vector<double> ss(Dim);
         if (!reached_end_of_mesh)
         {
-          mesh_geom_obj_pt[i_mesh]->locate_zeta(x_global, sub_geom_obj_pt, ss);
+          // Don't bother searching if the zeta can't be located in any of
+          // the non-halo elements here
+          if ((!Use_bounding_boxes_in_ring_search) ||
+              zeta_is_in_bounding_box(my_rank, i_mesh, n_mesh, x_global))
+          {
+            mesh_geom_obj_pt[i_mesh]->locate_zeta(
+              x_global, sub_geom_obj_pt, ss);
+          }
 
           // Did the locate method work?
           if (sub_geom_obj_pt != 0)
@@ -2146,6 +2408,178 @@ namespace oomph
 #endif
 
 
+    //=====================================================================
+    /// Check whether the external elements assigned during the previous
+    /// multi-domain setup for the given meshes, external mesh and
+    /// interaction may still be used: the external mesh must contain the
+    /// same elements (in the same order) as at the end of that setup.
+    /// Otherwise it has been adapted (or its elements have been
+    /// re-allocated), and the previous external elements may have been
+    /// deleted, even if an element at the same address exists now.
+    //=====================================================================
+    bool previous_external_elements_are_valid(
+      const Vector<Mesh*>& mesh_pt,
+      Mesh* const& external_mesh_pt,
+      const unsigned& interaction_index)
+    {
+      std::map<std::pair<std::pair<Mesh*, unsigned>, std::vector<Mesh*>>,
+               Vector<GeneralisedElement*>>::const_iterator it =
+        External_mesh_element_pt_at_last_setup.find(std::make_pair(
+          std::make_pair(external_mesh_pt, interaction_index),
+          std::vector<Mesh*>(mesh_pt.begin(), mesh_pt.end())));
+      if (it == External_mesh_element_pt_at_last_setup.end())
+      {
+        return false;
+      }
+
+      const Vector<GeneralisedElement*>& element_pt = it->second;
+      unsigned n_ext_element = external_mesh_pt->nelement();
+      if (element_pt.size() != n_ext_element)
+      {
+        return false;
+      }
+      for (unsigned e = 0; e < n_ext_element; e++)
+      {
+        if (element_pt[e] != external_mesh_pt->element_pt(e))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    //=====================================================================
+    /// Record the elements of the external mesh at the end of a
+    /// multi-domain setup for the given meshes and interaction
+    //=====================================================================
+    void record_external_elements(const Vector<Mesh*>& mesh_pt,
+                                  Mesh* const& external_mesh_pt,
+                                  const unsigned& interaction_index)
+    {
+      Vector<GeneralisedElement*>& element_pt =
+        External_mesh_element_pt_at_last_setup[std::make_pair(
+          std::make_pair(external_mesh_pt, interaction_index),
+          std::vector<Mesh*>(mesh_pt.begin(), mesh_pt.end()))];
+      unsigned n_ext_element = external_mesh_pt->nelement();
+      element_pt.resize(n_ext_element);
+      for (unsigned e = 0; e < n_ext_element; e++)
+      {
+        element_pt[e] = external_mesh_pt->element_pt(e);
+      }
+    }
+
+
+    //=====================================================================
+    /// Try to locate the current set of "local" zeta coordinates in the
+    /// external elements that were assigned during the previous multi-domain
+    /// setup, using the previous local coordinates as the initial guess.
+    //=====================================================================
+    void locate_zeta_in_previous_external_elements(
+      const Vector<Mesh*>& mesh_pt,
+      Mesh* const& external_mesh_pt,
+      const unsigned& interaction_index)
+    {
+      // If the external mesh has changed since the previous setup, the
+      // previous external elements can't be trusted
+      if (!previous_external_elements_are_valid(
+            mesh_pt, external_mesh_pt, interaction_index))
+      {
+        return;
+      }
+
+      // Set of elements that are (still) contained in the external mesh;
+      // previous external elements that are not in this set may have been
+      // deleted (e.g. during mesh adaptation or because they were
+      // external halo elements) and must not be accessed.
+      std::set<GeneralisedElement*> external_element_set;
+      unsigned n_ext_element = external_mesh_pt->nelement();
+      for (unsigned e = 0; e < n_ext_element; e++)
+      {
+        external_element_set.insert(external_mesh_pt->element_pt(e));
+      }
+
+      // Element counter
+      unsigned e_count = 0;
+
+      // Loop over meshes
+      unsigned n_mesh = mesh_pt.size();
+      for (unsigned i_mesh = 0; i_mesh < n_mesh; i_mesh++)
+      {
+        // Loop over this processor's elements
+        unsigned n_element = mesh_pt[i_mesh]->nelement();
+        for (unsigned e = 0; e < n_element; e++)
+        {
+          ElementWithExternalElement* el_pt =
+            dynamic_cast<ElementWithExternalElement*>(
+              mesh_pt[i_mesh]->element_pt(e));
+
+          // Number of integration points for which we have previous
+          // information (zero for halo elements)
+          unsigned n_intpt = Previous_external_element_pt[e_count].size();
+          if (n_intpt > 0)
+          {
+            unsigned el_dim = el_pt->dim();
+            Vector<double> s_local(el_dim);
+            Vector<double> x_global(el_dim);
+
+            // Loop over integration points
+            for (unsigned ipt = 0; ipt < n_intpt; ipt++)
+            {
+              FiniteElement* prev_el_pt =
+                Previous_external_element_pt[e_count][ipt];
+
+              // Is the previous element still available?
+              if ((prev_el_pt == 0) ||
+                  (external_element_set.count(prev_el_pt) == 0))
+              {
+                continue;
+              }
+#ifdef OOMPH_HAS_MPI
+              if ((!Allow_use_of_halo_elements_as_external_elements) &&
+                  prev_el_pt->is_halo())
+              {
+                continue;
+              }
+#endif
+
+              // Get global coordinates of integration point
+              for (unsigned i = 0; i < el_dim; i++)
+              {
+                s_local[i] = el_pt->integral_pt()->knot(ipt, i);
+              }
+              el_pt->interpolated_zeta(s_local, x_global);
+
+              // Try to locate it in the previous element, starting from
+              // the previous local coordinates
+              Vector<double> s_ext(
+                Previous_external_element_local_coord[e_count][ipt]);
+              if (s_ext.size() != prev_el_pt->dim())
+              {
+                continue;
+              }
+              GeomObject* sub_geom_obj_pt = 0;
+              prev_el_pt->locate_zeta(x_global, sub_geom_obj_pt, s_ext, true);
+
+              // Success?
+              if (sub_geom_obj_pt != 0)
+              {
+                el_pt->external_element_pt(interaction_index, ipt) =
+                  prev_el_pt;
+                el_pt->external_element_local_coord(interaction_index, ipt) =
+                  s_ext;
+                External_element_located[e_count][ipt] = 1;
+              }
+            }
+          }
+
+          // Bump up counter for all elements
+          e_count++;
+        }
+      }
+    }
+
+
     //=====================================================================
     /// locate zeta for current set of "local" coordinates
     /// vector-based version
@@ -2420,6 +2854,8 @@ namespace oomph
       Flat_packed_doubles.clear();
       Flat_packed_unsigneds.clear();
       External_element_located.clear();
+      Previous_external_element_pt.clear();
+      Previous_external_element_local_coord.clear();
     }
 
     /// Vector of zeta coordinates that we're currently trying to locate;
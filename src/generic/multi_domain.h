@@ -78,6 +78,34 @@ namespace oomph
     /// elements over and over again when we go around the spirals.
     extern Vector<Vector<unsigned>> External_element_located;
 
+    /// \short Boolean to indicate that the external elements (and the
+    /// local coordinates within them) that were assigned during the previous
+    /// multi-domain setup should be tried first, before the full
+    /// (bin-based) search is performed. This is helpful if the meshes
+    /// have only moved slightly since the last setup, e.g. in
+    /// time-dependent problems with moving meshes. Defaults to false.
+    /// Only used if Use_bulk_element_as_external is false.
+    extern bool Use_previous_external_element_as_initial_guess;
+
+    /// \short External elements assigned during the previous multi-domain
+    /// setup (in the same flat-packed element ordering as
+    /// External_element_located); used if
+    /// Use_previous_external_element_as_initial_guess is true.
+    extern Vector<Vector<FiniteElement*>> Previous_external_element_pt;
+
+    /// \short Local coordinates in the external elements assigned during
+    /// the previous multi-domain setup; used if
+    /// Use_previous_external_element_as_initial_guess is true.
+    extern Vector<Vector<Vector<double>>> Previous_external_element_local_coord;
+
+    /// \short Wipe the record of the external meshes used in previous
+    /// multi-domain setups, so that the external elements assigned during
+    /// those setups are not used as initial guesses. This is done
+    /// automatically if the elements of an external mesh have changed
+    /// (e.g. during mesh adaptation); call it explicitly if the external
+    /// elements were changed in any other way.
+    void invalidate_previous_external_elements();
+
     /// \short Vector of flat-packed zeta coordinates for which the external
     /// element could not be found during current local search. These
     /// will be sent to the next processor in the ring-like parallel search.
@@ -169,6 +197,32 @@ namespace oomph
     /// stage. Default set to true
     extern bool Allow_use_of_halo_elements_as_external_elements_for_projection;
 
+    /// \short Boolean to indicate that the bounding boxes (in zeta-space)
+    /// of the non-halo external elements on all processors should be
+    /// exchanged before the ring-based parallel search. Zetas are then only
+    /// searched for on processors whose bounding box contains them, and
+    /// the ring is terminated as soon as no processor further along the
+    /// ring can possibly contain any of the missing zetas. Defaults to false.
+    extern bool Use_bounding_boxes_in_ring_search;
+
+    /// \short Padding applied to the bounding boxes used in the ring-based
+    /// search, as a fraction of their extent (to allow for curved
+    /// elements and the tolerance in the locate_zeta(...) methods).
+    extern double Bounding_box_relative_padding;
+
+    /// \short Tolerance added to the padding of all bounding boxes used in
+    /// the ring-based search, as a fraction of the largest extent of any
+    /// bounding box on any processor (or as an absolute value if all
+    /// boxes are degenerate). Ensures that boxes with zero extent in some
+    /// direction still accept zetas that only differ by round-off.
+    extern double Bounding_box_tolerance;
+
+    /// \short Flat-packed (padded) bounding boxes of the non-halo external
+    /// elements on all processors: the min/max of the i-th zeta coordinate
+    /// for mesh i_mesh on processor proc are stored in entries
+    /// 2*((proc*n_mesh+i_mesh)*Dim+i) and 2*((proc*n_mesh+i_mesh)*Dim+i)+1.
+    extern Vector<double> Flat_packed_bounding_boxes;
+
     /// \short Boolean to indicate whether to doc timings or not.
     extern bool Doc_timings;
 
@@ -344,6 +398,35 @@ namespace oomph
       const unsigned& interaction_index,
       const Vector<Mesh*>& external_face_mesh_pt);
 
+    /// \short Helper function that checks whether the external elements
+    /// assigned during the previous multi-domain setup for the given meshes,
+    /// external mesh and interaction may still be used as initial guesses,
+    /// i.e. whether the elements of the external mesh are still the same
+    /// as at the end of that setup.
+    bool previous_external_elements_are_valid(
+      const Vector<Mesh*>& mesh_pt,
+      Mesh* const& external_mesh_pt,
+      const unsigned& interaction_index);
+
+    /// \short Helper function that records the elements of the external
+    /// mesh at the end of a multi-domain setup, so the next setup can
+    /// check that they haven't changed
+    void record_external_elements(const Vector<Mesh*>& mesh_pt,
+                                  Mesh* const& external_mesh_pt,
+                                  const unsigned& interaction_index);
+
+    /// \short Helper function that tries to locate the "local" zeta
+    /// coordinates in the external elements that were assigned during the
+    /// previous multi-domain setup (stored in Previous_external_element_pt).
+    /// Nothing is done if the elements of the external mesh have changed
+    /// since that setup, and only elements that are still contained in the
+    /// external mesh are considered; zetas that can't be located in this
+    /// way are left for the full search.
+    void locate_zeta_in_previous_external_elements(
+      const Vector<Mesh*>& mesh_pt,
+      Mesh* const& external_mesh_pt,
+      const unsigned& interaction_index);
+
     /// \short Helper function to locate "local" zeta coordinates
     /// This is the vector-based version which operates simultaenously
     /// on the meshes contained in the Vectors.
@@ -356,6 +439,25 @@ namespace oomph
 
 #ifdef OOMPH_HAS_MPI
 
+    /// \short Helper function to set up (and exchange) the bounding boxes
+    /// of the non-halo external elements on all processors, used when
+    /// Use_bounding_boxes_in_ring_search is true
+    void setup_bounding_boxes_for_ring_search(
+      Problem* problem_pt, Vector<MeshAsGeomObject*>& mesh_geom_obj_pt);
+
+    /// \short Is the zeta coordinate x_global contained in the bounding box
+    /// of mesh i_mesh (out of n_mesh) on processor proc?
+    bool zeta_is_in_bounding_box(const int& proc,
+                                 const unsigned& i_mesh,
+                                 const unsigned& n_mesh,
+                                 const Vector<double>& x_global);
+
+    /// \short Number of stages of the ring-based search that are required
+    /// (across all processors) for the missing zetas to visit all
+    /// processors whose bounding boxes contain them.
+    int nring_search_stage_required(Problem* problem_pt,
+                                    const unsigned& n_mesh);
+
     /// \short Helper function to send any "missing" zeta coordinates to
     /// the next process and receive any coordinates from previous process
     void send_and_receive_missing_zetas(Problem* problem_pt);
@@ -690,6 +690,18 @@ namespace oomph
 
     } // end of loop over meshes
 
+#ifdef OOMPH_HAS_MPI
+    // Exchange the bounding boxes of the non-halo external elements
+    // so the ring-based search can be restricted to processors that can
+    // actually contain the missing zetas
+    if (Use_bounding_boxes_in_ring_search &&
+        (problem_pt->communicator_pt()->nproc() > 1) &&
+        problem_pt->problem_has_been_distributed())
+    {
+      setup_bounding_boxes_for_ring_search(problem_pt, mesh_geom_obj_pt);
+    }
+#endif
+
     double t_setup_lookups = 0.0;
     if (Doc_timings)
     {
@@ -712,6 +724,16 @@ namespace oomph
     }
     External_element_located.resize(e_count);
 
+    // Do we try the previous external elements first?
+    bool use_previous_external_element =
+      (Use_previous_external_element_as_initial_guess &&
+       (!Use_bulk_element_as_external));
+    if (use_previous_external_element)
+    {
+      Previous_external_element_pt.resize(e_count);
+      Previous_external_element_local_coord.resize(e_count);
+    }
+
     // Reset counter for elements in flat packed storage
     e_count = 0;
 
@@ -740,10 +762,23 @@ namespace oomph
           // points within the element has changed.
           el_pt->initialise_external_element_storage();
 
-          // Clear any previous allocation
+          // Clear any previous allocation (but keep a record of it
+          // if we want to use it as the initial guess)
           unsigned n_intpt = el_pt->integral_pt()->nweight();
+          if (use_previous_external_element)
+          {
+            Previous_external_element_pt[e_count].resize(n_intpt, 0);
+            Previous_external_element_local_coord[e_count].resize(n_intpt);
+          }
           for (unsigned ipt = 0; ipt < n_intpt; ipt++)
           {
+            if (use_previous_external_element)
+            {
+              Previous_external_element_pt[e_count][ipt] =
+                el_pt->external_element_pt(interaction_index, ipt);
+              Previous_external_element_local_coord[e_count][ipt] =
+                el_pt->external_element_local_coord(interaction_index, ipt);
+            }
             el_pt->external_element_pt(interaction_index, ipt) = 0;
           }
 
@@ -767,6 +802,27 @@ namespace oomph
         << t - t_setup_lookups << std::endl;
     }
 
+    // Try the external elements from the previous setup first
+    if (use_previous_external_element)
+    {
+      double t_previous = 0.0;
+      if (Doc_timings)
+      {
+        t_previous = TimingHelpers::timer();
+      }
+
+      locate_zeta_in_previous_external_elements(
+        mesh_pt, external_mesh_pt, interaction_index);
+
+      if (Doc_timings)
+      {
+        double t = TimingHelpers::timer();
+        oomph_info
+          << "CPU for location of zeta coordinates in previous external "
+          << "elements: " << t - t_previous << std::endl;
+      }
+    }
+
     // Initialise maximum spiral level within the cartesian bin structure
     // Used to terminate spiraling for non-refineable bin
     unsigned n_max_level = 0;
@@ -1000,7 +1056,15 @@ namespace oomph
         // to locate an element for the current set of not-yet-located
         // zeta coordinates
         unsigned ring_count = 0;
-        for (int iproc = 1; iproc < n_proc; iproc++)
+
+        // No need to go any further around the ring than the furthest
+        // processor whose bounding box contains any of the missing zetas
+        int n_ring_stage = n_proc - 1;
+        if (Use_bounding_boxes_in_ring_search)
+        {
+          n_ring_stage = nring_search_stage_required(problem_pt, n_mesh);
+        }
+        for (int iproc = 1; iproc <= n_ring_stage; iproc++)
         {
           // Record time at start of loop
           if (Doc_timings)
@@ -1108,7 +1172,7 @@ namespace oomph
         {
           oomph_info << "Ring-based search continued until iteration "
                      << ring_count << " out of a maximum of "
-                     << problem_pt->communicator_pt()->nproc() - 1 << "\n";
+                     << n_ring_stage << "\n";
           oomph_info << "Total, av, max, min CPU for send/recv of remaining "
                         "zeta coordinates: "
                      << t_sendrecv_tot << " "
@@ -1494,6 +1558,13 @@ namespace oomph
       delete mesh_geom_obj_pt[i_mesh];
     }
 
+    // Record the elements of the external mesh, so the next setup can
+    // check whether the external elements assigned here are still valid
+    if (use_previous_external_element)
+    {
+      record_external_elements(mesh_pt, external_mesh_pt, interaction_index);
+    }
+
     // Clean up all the (extern) Vectors associated with creating the
     // external storage information
     clean_up();
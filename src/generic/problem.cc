@@ -2086,6 +2086,14 @@ namespace oomph
 #endif
 
 
+    // Any element colourings are out of date once the elements or the
+    // equation numbers change; they are rebuilt when next required
+    Mesh_pt->flush_element_colouring();
+    for (unsigned i = 0; i < n_sub_mesh; i++)
+    {
+      Sub_mesh_pt[i]->flush_element_colouring();
+    }
+
     double t_end = 0.0;
     if (Global_timings::Doc_comprehensive_timings)
     {
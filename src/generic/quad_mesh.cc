@@ -100,13 +100,12 @@ namespace oomph
                 // Add pointer to finite element to vector for the appropriate
                 // boundary
 
-                // Does the pointer already exits in the vector
-                Vector<FiniteElement*>::iterator b_el_it =
-                  std::find(vector_of_boundary_element_pt[*it].begin(),
-                            vector_of_boundary_element_pt[*it].end(),
-                            fe_pt);
-                // Only insert if we have not found it (i.e. got to the end)
-                if (b_el_it == vector_of_boundary_element_pt[*it].end())
+                // Only insert if the element isn't in the vector yet. The
+                // elements are visited one at a time, so if it's there at
+                // all it was the last one to be added: no need to search
+                // the whole vector.
+                if (vector_of_boundary_element_pt[*it].empty() ||
+                    (vector_of_boundary_element_pt[*it].back() != fe_pt))
                 {
                   vector_of_boundary_element_pt[*it].push_back(fe_pt);
                 }
@@ -1246,12 +1246,22 @@ namespace oomph
   public:
     static Vector<double> z;
 
+    /// \short Legendre polynomial of degree NNODE_1D-1 evaluated at
+    /// the nodes z (stored to avoid re-computing it for every evaluation
+    /// of the shape functions and their derivatives)
+    static Vector<double> Legendre_at_nodes;
+
     /// Static function used to populate the stored positions
     static inline void calculate_nodal_positions()
     {
       if (!Nodes_calculated)
       {
         Orthpoly::gll_nodes(NNODE_1D, z);
+        Legendre_at_nodes.resize(NNODE_1D);
+        for (unsigned i = 0; i < NNODE_1D; i++)
+        {
+          Legendre_at_nodes[i] = Orthpoly::legendre(NNODE_1D - 1, z[i]);
+        }
         Nodes_calculated = true;
       }
     }
@@ -1267,6 +1277,11 @@ namespace oomph
       using namespace Orthpoly;
 
       unsigned p = NNODE_1D - 1;
+
+      // The parts that don't depend on the node only have to be computed
+      // once
+      const double numerator = (1.0 - s * s) * dlegendre(p, s);
+
       // Now populate the shape function
       for (unsigned i = 0; i < NNODE_1D; i++)
       {
@@ -1278,8 +1293,8 @@ namespace oomph
         // Otherwise use the lagrangian interpolant
         else
         {
-          (*this)[i] = (1.0 - s * s) * dlegendre(p, s) /
-                       (p * (p + 1) * legendre(p, z[i]) * (z[i] - s));
+          (*this)[i] =
+            numerator / (p * (p + 1) * Legendre_at_nodes[i] * (z[i] - s));
         }
       }
     }
@@ -1288,6 +1303,9 @@ namespace oomph
   template<unsigned NNODE_1D>
   Vector<double> OneDimensionalLegendreShape<NNODE_1D>::z;
 
+  template<unsigned NNODE_1D>
+  Vector<double> OneDimensionalLegendreShape<NNODE_1D>::Legendre_at_nodes;
+
   template<unsigned NNODE_1D>
   bool OneDimensionalLegendreShape<NNODE_1D>::Nodes_calculated = false;
 
@@ -1300,24 +1318,27 @@ namespace oomph
     OneDimensionalLegendreDShape(const double& s) : Shape(NNODE_1D)
     {
       unsigned p = NNODE_1D - 1;
-      Vector<double> z = OneDimensionalLegendreShape<NNODE_1D>::z;
-
+      const Vector<double>& z = OneDimensionalLegendreShape<NNODE_1D>::z;
+      const Vector<double>& legendre_at_z =
+        OneDimensionalLegendreShape<NNODE_1D>::Legendre_at_nodes;
 
+      // Check if s happens to be a root (this doesn't depend on
+      // the shape function so only needs to be done once)
       bool root = false;
-
-      for (unsigned i = 0; i < NNODE_1D; i++)
+      unsigned rootnum = 0;
+      for (unsigned j = 0; j < NNODE_1D; j++)
       {
-        unsigned rootnum = 0;
-        for (unsigned j = 0; j < NNODE_1D; j++)
-        { // Loop over roots to check if
-          if (std::fabs(s - z[j]) < 10 * Orthpoly::eps)
-          { // s happens to be a root.
-            root = true;
-            break;
-          }
-          rootnum += 1;
+        if (std::fabs(s - z[j]) < 10 * Orthpoly::eps)
+        {
+          root = true;
+          break;
         }
-        if (root == true)
+        rootnum += 1;
+      }
+
+      if (root == true)
+      {
+        for (unsigned i = 0; i < NNODE_1D; i++)
         {
           if (i == rootnum && i == 0)
           {
@@ -1333,18 +1354,23 @@ namespace oomph
           }
           else
           {
-            (*this)[i] = Orthpoly::legendre(p, z[rootnum]) /
-                         Orthpoly::legendre(p, z[i]) / (z[rootnum] - z[i]);
+            (*this)[i] =
+              legendre_at_z[rootnum] / legendre_at_z[i] / (z[rootnum] - z[i]);
           }
         }
-        else
+      }
+      else
+      {
+        // Legendre polynomial derivatives at s are the same for all
+        // shape functions
+        const double dlegendre_s = Orthpoly::dlegendre(p, s);
+        const double ddlegendre_s = Orthpoly::ddlegendre(p, s);
+        for (unsigned i = 0; i < NNODE_1D; i++)
         {
-          (*this)[i] =
-            ((1 + s * (s - 2 * z[i])) / (s - z[i]) * Orthpoly::dlegendre(p, s) -
-             (1 - s * s) * Orthpoly::ddlegendre(p, s)) /
-            p / (p + 1.0) / Orthpoly::legendre(p, z[i]) / (s - z[i]);
+          (*this)[i] = ((1 + s * (s - 2 * z[i])) / (s - z[i]) * dlegendre_s -
+                        (1 - s * s) * ddlegendre_s) /
+                       p / (p + 1.0) / legendre_at_z[i] / (s - z[i]);
         }
-        root = false;
       }
     }
   };
@@ -28,6 +28,7 @@
 
 #include "spines.h"
 #include <cstdlib>
+#include <map>
 
 namespace oomph
 {
@@ -97,8 +98,36 @@ namespace oomph
     }
 #endif
 
-    // Loop over all the nodes
+    // Number of nodes
     unsigned long Node_pt_range = Node_pt.size();
+
+    // Update the nodes spine by spine?
+    if (Use_spine_ordered_node_update)
+    {
+      // Re-build the grouping if nodes have been added or removed
+      if (Spine_ordered_node_pt.size() != Node_pt_range)
+      {
+        setup_spine_ordered_node_update();
+      }
+
+      // Update the nodes on each spine
+      const unsigned long n_spine = Spine_pt.size();
+      for (unsigned long i = 0; i < n_spine; i++)
+      {
+        spine_ordered_node_update(i);
+      }
+
+      // Update the remaining nodes individually
+      for (unsigned long l = First_spine_ordered_node_index[n_spine];
+           l < Node_pt_range;
+           l++)
+      {
+        Spine_ordered_node_pt[l]->node_update();
+      }
+      return;
+    }
+
+    // Loop over all the nodes
     for (unsigned long l = 0; l < Node_pt_range; l++)
     {
 #ifdef PARANOID
@@ -113,8 +142,89 @@ namespace oomph
       }
 #endif
 
-      // Need to cast to spine node to get to update function
-      dynamic_cast<SpineNode*>(Node_pt[l])->node_update();
+      // Need to cast to spine node to get to update function. The node
+      // is a SpineNode (checked above under PARANOID), so a static_cast
+      // is sufficient
+      static_cast<SpineNode*>(Node_pt[l])->node_update();
+    }
+  }
+
+  //============================================================
+  /// Default spine-ordered node update for the nodes on the i-th
+  /// spine: Call their node_update() functions in turn.
+  //============================================================
+  void SpineMesh::spine_ordered_node_update(const unsigned long& i)
+  {
+    const unsigned long l_last = First_spine_ordered_node_index[i + 1];
+    for (unsigned long l = First_spine_ordered_node_index[i]; l < l_last; l++)
+    {
+      Spine_ordered_node_pt[l]->node_update();
+    }
+  }
+
+  //============================================================
+  /// Group the nodes by spine for the spine-ordered node update.
+  /// Nodes whose spine is not one of this mesh's spines, or whose
+  /// update is performed by a different SpineMesh, are stored at the
+  /// end and are updated individually.
+  //============================================================
+  void SpineMesh::setup_spine_ordered_node_update()
+  {
+    // Number the spines
+    const unsigned long n_spine = Spine_pt.size();
+    std::map<Spine*, unsigned long> spine_number;
+    for (unsigned long i = 0; i < n_spine; i++)
+    {
+      spine_number[Spine_pt[i]] = i;
+    }
+
+    // Find the spine number of each node (n_spine for the remaining
+    // nodes) and count the nodes on each spine
+    const unsigned long n_node = Node_pt.size();
+    Vector<unsigned long> node_spine_number(n_node, n_spine);
+    Vector<unsigned long> count(n_spine + 1, 0);
+    for (unsigned long l = 0; l < n_node; l++)
+    {
+#ifdef PARANOID
+      if (!dynamic_cast<SpineNode*>(Node_pt[l]))
+      {
+        std::ostringstream error_stream;
+        error_stream << "Error: Node " << l << "is a "
+                     << typeid(Node_pt[l]).name() << ", not a SpineNode"
+                     << std::endl;
+        throw OomphLibError(
+          error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+      }
+#endif
+      SpineNode* nod_pt = static_cast<SpineNode*>(Node_pt[l]);
+      if (nod_pt->spine_mesh_pt() == this)
+      {
+        std::map<Spine*, unsigned long>::iterator it =
+          spine_number.find(nod_pt->spine_pt());
+        if (it != spine_number.end())
+        {
+          node_spine_number[l] = it->second;
+        }
+      }
+      count[node_spine_number[l]]++;
+    }
+
+    // Offsets of the groups
+    First_spine_ordered_node_index.resize(n_spine + 2);
+    First_spine_ordered_node_index[0] = 0;
+    for (unsigned long i = 0; i <= n_spine; i++)
+    {
+      First_spine_ordered_node_index[i + 1] =
+        First_spine_ordered_node_index[i] + count[i];
+    }
+
+    // Sort the nodes into their groups, preserving their relative order
+    Spine_ordered_node_pt.resize(n_node);
+    Vector<unsigned long> next(First_spine_ordered_node_index);
+    for (unsigned long l = 0; l < n_node; l++)
+    {
+      Spine_ordered_node_pt[next[node_spine_number[l]]++] =
+        static_cast<SpineNode*>(Node_pt[l]);
     }
   }
 
@@ -615,7 +615,27 @@ namespace oomph
     /// A Spine mesh contains a Vector of pointers to spines
     Vector<Spine*> Spine_pt;
 
+    /// \short Nodes, grouped by spine, for the spine-ordered node update:
+    /// The nodes on the i-th spine occupy the contiguous entries
+    /// First_spine_ordered_node_index[i] to
+    /// First_spine_ordered_node_index[i+1]-1. Nodes that are not updated
+    /// by this mesh via one of its spines are stored at the end, from
+    /// entry First_spine_ordered_node_index[nspine()] onwards.
+    Vector<SpineNode*> Spine_ordered_node_pt;
+
+    /// \short Index of the first entry in Spine_ordered_node_pt for each
+    /// spine (plus one more entry for the remaining nodes)
+    Vector<unsigned long> First_spine_ordered_node_index;
+
+    /// \short Boolean flag to indicate if the spine-ordered node update
+    /// is to be used
+    bool Use_spine_ordered_node_update;
+
   public:
+    /// Constructor: By default the nodes are updated in the order in which
+    /// they are stored in the mesh
+    SpineMesh() : Use_spine_ordered_node_update(false) {}
+
     /// Destructor to clean up the memory allocated to the spines
     virtual ~SpineMesh();
 
@@ -659,8 +679,9 @@ namespace oomph
                             OOMPH_EXCEPTION_LOCATION);
       }
 #endif
-      // Return a cast to the pointer to the node
-      return (dynamic_cast<SpineNode*>(Node_pt[n]));
+      // Return a cast to the pointer to the node (checked above under
+      // PARANOID, so no need for a dynamic_cast)
+      return (static_cast<SpineNode*>(Node_pt[n]));
     }
 
     /// \short Return the n-th local SpineNode in element e.
@@ -749,6 +770,46 @@ namespace oomph
     /// by all specific SpineMeshes.
     virtual void spine_node_update(SpineNode* spine_node_pt) = 0;
 
+    /// \short Update the positions of all nodes that are located on the
+    /// i-th spine; these are the entries First_spine_ordered_node_index[i]
+    /// to First_spine_ordered_node_index[i+1]-1 in Spine_ordered_node_pt.
+    /// Only used by the spine-ordered node update. The default
+    /// implementation calls the nodes' node_update() functions in turn;
+    /// specific SpineMeshes can overload it to extract the spine height
+    /// (and any other spine data) once per spine rather than once per
+    /// node. Overloaded versions must perform any auxiliary node updates.
+    virtual void spine_ordered_node_update(const unsigned long& i);
+
+    /// \short Enable the spine-ordered node update: node_update() then
+    /// updates the nodes spine by spine, via spine_ordered_node_update(...),
+    /// rather than in the order in which they are stored in the mesh.
+    /// The grouping of the nodes is set up here and is re-built
+    /// automatically if the number of nodes changes; it must be re-built
+    /// explicitly (by calling this function again) if nodes are
+    /// re-assigned to different spines or replaced.
+    void enable_spine_ordered_node_update()
+    {
+      setup_spine_ordered_node_update();
+      Use_spine_ordered_node_update = true;
+    }
+
+    /// \short Disable the spine-ordered node update (the default)
+    void disable_spine_ordered_node_update()
+    {
+      Use_spine_ordered_node_update = false;
+      Spine_ordered_node_pt.clear();
+      First_spine_ordered_node_index.clear();
+    }
+
+    /// \short Return whether the spine-ordered node update is used
+    bool is_spine_ordered_node_update_enabled() const
+    {
+      return Use_spine_ordered_node_update;
+    }
+
+    /// \short Group the nodes by spine for the spine-ordered node update
+    void setup_spine_ordered_node_update();
+
 #ifdef __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Woverloaded-virtual"
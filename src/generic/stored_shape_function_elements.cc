@@ -195,6 +195,9 @@ namespace oomph
     }
     // Reset the pointer to zero, even if copied
     Jacobian_eulerian_stored_pt = 0;
+
+    // The stored nodal positions no longer refer to anything
+    Nodal_position_stored.clear();
   }
 
 
@@ -510,6 +513,9 @@ namespace oomph
       Jacobian_eulerian_stored_pt->push_back(
         FiniteElement::J_eulerian_at_knot(ipt));
     }
+
+    // Remember the nodal positions the Jacobian was computed for
+    store_nodal_positions();
   }
 
   //========================================================================
@@ -570,6 +576,9 @@ namespace oomph
       // Add the pointer to the vector of stored DShape objects
       DShape_eulerian_stored_pt->push_back(dpsidx_pt);
     } // End of loop over integration points
+
+    // Remember the nodal positions the derivatives were computed for
+    store_nodal_positions();
   }
 
   //========================================================================
@@ -662,6 +671,105 @@ namespace oomph
       DShape_eulerian_stored_pt->push_back(dpsidx_pt);
       D2Shape_eulerian_stored_pt->push_back(d2psidx_pt);
     } // End of loop over the shape functions
+
+    // Remember the nodal positions the derivatives were computed for
+    store_nodal_positions();
+  }
+
+  //=========================================================================
+  /// \short Copy the current nodal positions (all position types and
+  /// coordinates, node by node) into Nodal_position_stored.
+  //=========================================================================
+  void StorableShapeElementBase::store_nodal_positions()
+  {
+    const unsigned n_node = nnode();
+    const unsigned n_position_type = nnodal_position_type();
+    const unsigned n_dim = nodal_dimension();
+    Nodal_position_stored.resize(n_node * n_position_type * n_dim);
+    unsigned count = 0;
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      for (unsigned k = 0; k < n_position_type; k++)
+      {
+        for (unsigned i = 0; i < n_dim; i++)
+        {
+          Nodal_position_stored[count] = nodal_position_gen(l, k, i);
+          count++;
+        }
+      }
+    }
+  }
+
+  //=========================================================================
+  /// \short Have the nodes moved since the Eulerian derivatives of the
+  /// shape functions and/or the Jacobian of the mapping were pre-computed?
+  /// Always returns false if nothing is stored, or if the stored data
+  /// is shared with (and therefore maintained by) another element.
+  //=========================================================================
+  bool StorableShapeElementBase::stored_eulerian_data_is_outdated() const
+  {
+    // Nothing stored, or the storage isn't ours
+    if ((Jacobian_eulerian_stored_pt == 0) ||
+        (!Can_delete_dshape_eulerian_stored))
+    {
+      return false;
+    }
+
+    const unsigned n_node = nnode();
+    const unsigned n_position_type = nnodal_position_type();
+    const unsigned n_dim = nodal_dimension();
+
+    // The number of nodes (or their dimension) has changed
+    if (Nodal_position_stored.size() != n_node * n_position_type * n_dim)
+    {
+      return true;
+    }
+
+    // Compare with the positions that were used to compute the data
+    unsigned count = 0;
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      for (unsigned k = 0; k < n_position_type; k++)
+      {
+        for (unsigned i = 0; i < n_dim; i++)
+        {
+          if (Nodal_position_stored[count] != nodal_position_gen(l, k, i))
+          {
+            return true;
+          }
+          count++;
+        }
+      }
+    }
+    return false;
+  }
+
+  //=========================================================================
+  /// \short Re-compute whichever Eulerian quantities are stored if the
+  /// nodes have moved since they were computed. Returns true if
+  /// a re-computation was performed.
+  //=========================================================================
+  bool StorableShapeElementBase::update_stored_eulerian_data_if_nodes_moved()
+  {
+    if (!stored_eulerian_data_is_outdated())
+    {
+      return false;
+    }
+
+    // Recompute the same quantities that are currently stored
+    if (D2Shape_eulerian_stored_pt != 0)
+    {
+      pre_compute_d2shape_eulerian_at_knots();
+    }
+    else if (DShape_eulerian_stored_pt != 0)
+    {
+      pre_compute_dshape_eulerian_at_knots();
+    }
+    else
+    {
+      pre_compute_J_eulerian_at_knots();
+    }
+    return true;
   }
 
   //=========================================================================
@@ -94,6 +94,20 @@ namespace oomph
     /// derivatives of shape functions w.r.t. global coordinates
     bool Can_delete_dshape_eulerian_stored;
 
+    /// \short Nodal positions (all position types and coordinates, listed
+    /// node by node) for which the stored derivatives w.r.t. global
+    /// coordinates and the Jacobian were computed.
+    Vector<double> Nodal_position_stored;
+
+    /// \short Boolean to indicate whether the stored derivatives w.r.t.
+    /// global coordinates and the Jacobian are checked (and recomputed
+    /// if the nodes have moved) before the residuals or Jacobian are
+    /// computed.
+    bool Automatic_update_of_stored_eulerian_data;
+
+    /// \short Record the current nodal positions in Nodal_position_stored
+    void store_nodal_positions();
+
   public:
     /// Constructor, set most storage pointers to NULL.
     // By default the element can delete its own stored shape functions
@@ -106,7 +120,8 @@ namespace oomph
         DShape_eulerian_stored_pt(0),
         D2Shape_eulerian_stored_pt(0),
         Jacobian_eulerian_stored_pt(0),
-        Can_delete_dshape_eulerian_stored(true)
+        Can_delete_dshape_eulerian_stored(true),
+        Automatic_update_of_stored_eulerian_data(false)
     {
     }
 
@@ -360,6 +375,52 @@ namespace oomph
                                     DShape& dpsidx,
                                     DShape& d2psidx) const;
 
+    /// \short Have the nodes moved since the derivatives of the shape
+    /// functions w.r.t. global coordinates and/or the Jacobian were
+    /// pre-computed? Always false if nothing is stored or if the storage
+    /// is shared with another element (whose data should be checked instead).
+    bool stored_eulerian_data_is_outdated() const;
+
+    /// \short Re-compute the stored derivatives of the shape functions
+    /// w.r.t. global coordinates and/or the Jacobian if the nodes have
+    /// moved since they were pre-computed. Returns true if a
+    /// re-computation was required.
+    bool update_stored_eulerian_data_if_nodes_moved();
+
+    /// \short Check (and if the nodes have moved, update) the stored
+    /// derivatives w.r.t. global coordinates and the Jacobian whenever
+    /// the residuals, Jacobian, mass matrix, their parameter derivatives,
+    /// Hessian-vector products or inner products are computed via the
+    /// GeneralisedElement interface. This makes it safe to use the stored
+    /// values in problems where the mesh moves occasionally. Other
+    /// functions that use the stored values (e.g. output or error
+    /// computations) are not covered: call
+    /// update_stored_eulerian_data_if_nodes_moved() before them if
+    /// required.
+    void enable_automatic_update_of_stored_eulerian_data()
+    {
+      Automatic_update_of_stored_eulerian_data = true;
+    }
+
+    /// \short Don't check the stored derivatives w.r.t. global coordinates
+    /// and the Jacobian before computing the residuals, Jacobian etc.
+    /// (default). They must then be updated by hand if the nodes move.
+    void disable_automatic_update_of_stored_eulerian_data()
+    {
+      Automatic_update_of_stored_eulerian_data = false;
+    }
+
+  protected:
+    /// \short Update the stored Eulerian data if the nodes have moved,
+    /// provided automatic updates are enabled. Called before the
+    /// residuals, Jacobian etc. are computed.
+    void update_stored_eulerian_data_if_required()
+    {
+      if (Automatic_update_of_stored_eulerian_data)
+      {
+        update_stored_eulerian_data_if_nodes_moved();
+      }
+    }
 
     /*  /// Diagnostic */
     /*  void tell_me() */
@@ -590,6 +651,108 @@ namespace oomph
     {
       BrokenCopy::broken_assign("StorableShapeElement");
     }
+
+    /// \short Compute the element's residual vector, having updated the
+    /// stored Eulerian data first, if required.
+    void get_residuals(Vector<double>& residuals)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_residuals(residuals);
+    }
+
+    /// \short Compute the element's residual vector and Jacobian matrix,
+    /// having updated the stored Eulerian data first, if required.
+    void get_jacobian(Vector<double>& residuals, DenseMatrix<double>& jacobian)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_jacobian(residuals, jacobian);
+    }
+
+    /// \short Compute the element's residual vector and mass matrix,
+    /// having updated the stored Eulerian data first, if required.
+    void get_mass_matrix(Vector<double>& residuals,
+                         DenseMatrix<double>& mass_matrix)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_mass_matrix(residuals, mass_matrix);
+    }
+
+    /// \short Compute the element's residual vector, Jacobian matrix and
+    /// mass matrix, having updated the stored Eulerian data first, if
+    /// required.
+    void get_jacobian_and_mass_matrix(Vector<double>& residuals,
+                                      DenseMatrix<double>& jacobian,
+                                      DenseMatrix<double>& mass_matrix)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_jacobian_and_mass_matrix(residuals, jacobian, mass_matrix);
+    }
+
+    /// \short Compute the derivatives of the residuals with respect to a
+    /// parameter, having updated the stored Eulerian data first, if
+    /// required.
+    void get_dresiduals_dparameter(double* const& parameter_pt,
+                                   Vector<double>& dres_dparam)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_dresiduals_dparameter(parameter_pt, dres_dparam);
+    }
+
+    /// \short Compute the derivatives of the residuals and the Jacobian
+    /// with respect to a parameter, having updated the stored Eulerian
+    /// data first, if required.
+    void get_djacobian_dparameter(double* const& parameter_pt,
+                                  Vector<double>& dres_dparam,
+                                  DenseMatrix<double>& djac_dparam)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_djacobian_dparameter(parameter_pt, dres_dparam, djac_dparam);
+    }
+
+    /// \short Compute the derivatives of the residuals, the Jacobian and
+    /// the mass matrix with respect to a parameter, having updated the
+    /// stored Eulerian data first, if required.
+    void get_djacobian_and_dmass_matrix_dparameter(
+      double* const& parameter_pt,
+      Vector<double>& dres_dparam,
+      DenseMatrix<double>& djac_dparam,
+      DenseMatrix<double>& dmass_matrix_dparam)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_djacobian_and_dmass_matrix_dparameter(
+        parameter_pt, dres_dparam, djac_dparam, dmass_matrix_dparam);
+    }
+
+    /// \short Compute the products of the Hessian with the vectors Y,
+    /// having updated the stored Eulerian data first, if required.
+    void get_hessian_vector_products(Vector<double> const& Y,
+                                     DenseMatrix<double> const& C,
+                                     DenseMatrix<double>& product)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_hessian_vector_products(Y, C, product);
+    }
+
+    /// \short Compute the inner products of the given history values,
+    /// having updated the stored Eulerian data first, if required.
+    void get_inner_products(
+      Vector<std::pair<unsigned, unsigned>> const& history_index,
+      Vector<double>& inner_product)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_inner_products(history_index, inner_product);
+    }
+
+    /// \short Compute the vectors that, when multiplied by the given
+    /// history values, give the inner products, having updated the stored
+    /// Eulerian data first, if required.
+    void get_inner_product_vectors(
+      Vector<unsigned> const& history_index,
+      Vector<Vector<double>>& inner_product_vector)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_inner_product_vectors(history_index, inner_product_vector);
+    }
   };
 
 
@@ -634,6 +797,108 @@ namespace oomph
     {
       BrokenCopy::broken_assign("StorableShapeSolidElement");
     }
+
+    /// \short Compute the element's residual vector, having updated the
+    /// stored Eulerian data first, if required.
+    void get_residuals(Vector<double>& residuals)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_residuals(residuals);
+    }
+
+    /// \short Compute the element's residual vector and Jacobian matrix,
+    /// having updated the stored Eulerian data first, if required.
+    void get_jacobian(Vector<double>& residuals, DenseMatrix<double>& jacobian)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_jacobian(residuals, jacobian);
+    }
+
+    /// \short Compute the element's residual vector and mass matrix,
+    /// having updated the stored Eulerian data first, if required.
+    void get_mass_matrix(Vector<double>& residuals,
+                         DenseMatrix<double>& mass_matrix)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_mass_matrix(residuals, mass_matrix);
+    }
+
+    /// \short Compute the element's residual vector, Jacobian matrix and
+    /// mass matrix, having updated the stored Eulerian data first, if
+    /// required.
+    void get_jacobian_and_mass_matrix(Vector<double>& residuals,
+                                      DenseMatrix<double>& jacobian,
+                                      DenseMatrix<double>& mass_matrix)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_jacobian_and_mass_matrix(residuals, jacobian, mass_matrix);
+    }
+
+    /// \short Compute the derivatives of the residuals with respect to a
+    /// parameter, having updated the stored Eulerian data first, if
+    /// required.
+    void get_dresiduals_dparameter(double* const& parameter_pt,
+                                   Vector<double>& dres_dparam)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_dresiduals_dparameter(parameter_pt, dres_dparam);
+    }
+
+    /// \short Compute the derivatives of the residuals and the Jacobian
+    /// with respect to a parameter, having updated the stored Eulerian
+    /// data first, if required.
+    void get_djacobian_dparameter(double* const& parameter_pt,
+                                  Vector<double>& dres_dparam,
+                                  DenseMatrix<double>& djac_dparam)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_djacobian_dparameter(parameter_pt, dres_dparam, djac_dparam);
+    }
+
+    /// \short Compute the derivatives of the residuals, the Jacobian and
+    /// the mass matrix with respect to a parameter, having updated the
+    /// stored Eulerian data first, if required.
+    void get_djacobian_and_dmass_matrix_dparameter(
+      double* const& parameter_pt,
+      Vector<double>& dres_dparam,
+      DenseMatrix<double>& djac_dparam,
+      DenseMatrix<double>& dmass_matrix_dparam)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_djacobian_and_dmass_matrix_dparameter(
+        parameter_pt, dres_dparam, djac_dparam, dmass_matrix_dparam);
+    }
+
+    /// \short Compute the products of the Hessian with the vectors Y,
+    /// having updated the stored Eulerian data first, if required.
+    void get_hessian_vector_products(Vector<double> const& Y,
+                                     DenseMatrix<double> const& C,
+                                     DenseMatrix<double>& product)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_hessian_vector_products(Y, C, product);
+    }
+
+    /// \short Compute the inner products of the given history values,
+    /// having updated the stored Eulerian data first, if required.
+    void get_inner_products(
+      Vector<std::pair<unsigned, unsigned>> const& history_index,
+      Vector<double>& inner_product)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_inner_products(history_index, inner_product);
+    }
+
+    /// \short Compute the vectors that, when multiplied by the given
+    /// history values, give the inner products, having updated the stored
+    /// Eulerian data first, if required.
+    void get_inner_product_vectors(
+      Vector<unsigned> const& history_index,
+      Vector<Vector<double>>& inner_product_vector)
+    {
+      this->update_stored_eulerian_data_if_required();
+      ELEMENT::get_inner_product_vectors(history_index, inner_product_vector);
+    }
   };
 
 } // namespace oomph
@@ -275,21 +275,15 @@ namespace oomph
           // If we have a boundary then add this to the appropriate set
           if (boundary >= 0)
           {
-            // Does the pointer already exits in the vector
-            Vector<FiniteElement*>::iterator b_el_it = std::find(
-              vector_of_boundary_element_pt[static_cast<unsigned>(boundary)]
-                .begin(),
-              vector_of_boundary_element_pt[static_cast<unsigned>(boundary)]
-                .end(),
-              fe_pt);
-
-            // Only insert if we have not found it (i.e. got to the end)
-            if (b_el_it ==
-                vector_of_boundary_element_pt[static_cast<unsigned>(boundary)]
-                  .end())
+            // Only insert if the element isn't in the vector yet. The
+            // elements are visited one at a time, so if it's there at all
+            // it was the last one to be added: no need to search the
+            // whole vector.
+            Vector<FiniteElement*>& boundary_el_pt =
+              vector_of_boundary_element_pt[static_cast<unsigned>(boundary)];
+            if (boundary_el_pt.empty() || (boundary_el_pt.back() != fe_pt))
             {
-              vector_of_boundary_element_pt[static_cast<unsigned>(boundary)]
-                .push_back(fe_pt);
+              boundary_el_pt.push_back(fe_pt);
             }
 
             // Also set the fixed face
@@ -23,12 +23,65 @@
 // LIC// The authors may be contacted at oomph-lib@maths.man.ac.uk.
 // LIC//
 // LIC//====================================================================
+#include <unordered_map>
+
 #include "mesh.h"
 #include "Telements.h"
 #include "tetgen_scaffold_mesh.h"
 
 namespace oomph
 {
+  namespace
+  {
+    //====================================================================
+    /// \short Pack the (tetgen 1-based) global node numbers at the ends
+    /// of an edge into a single key that does not depend on the order
+    /// in which the two nodes are listed.
+    //====================================================================
+    unsigned long long edge_key(const unsigned& first_node,
+                                const unsigned& second_node)
+    {
+      if (first_node < second_node)
+      {
+        return (static_cast<unsigned long long>(first_node) << 32) |
+               second_node;
+      }
+      return (static_cast<unsigned long long>(second_node) << 32) |
+             first_node;
+    }
+
+    /// \short Key for a triangular face: the first two of the sorted
+    /// global node numbers packed into an edge key, plus the third.
+    typedef std::pair<unsigned long long, unsigned> FaceKey;
+
+    //====================================================================
+    /// \short Build the key for the face spanned by three (tetgen 1-based)
+    /// global node numbers, independent of the order of the nodes.
+    //====================================================================
+    FaceKey face_key(unsigned n0, unsigned n1, unsigned n2)
+    {
+      if (n0 > n1) std::swap(n0, n1);
+      if (n1 > n2) std::swap(n1, n2);
+      if (n0 > n1) std::swap(n0, n1);
+      return FaceKey(edge_key(n0, n1), n2);
+    }
+
+    //====================================================================
+    /// Hash function for the face keys
+    //====================================================================
+    struct FaceKeyHash
+    {
+      std::size_t operator()(const FaceKey& key) const
+      {
+        const std::size_t h = std::hash<unsigned long long>()(key.first);
+        return h ^ (std::hash<unsigned>()(key.second) + 0x9e3779b9 +
+                    (h << 6) + (h >> 2));
+      }
+    };
+
+  } // namespace
+
+
   //======================================================================
   /// Constructor: Pass the filename of the tetrahedra file
   /// The assumptions are that the nodes have been assigned boundary
@@ -82,13 +135,13 @@ namespace oomph
 
     // Element attributes may be used to distinguish internal regions
     // NOTE: This stores doubles because tetgen forces us to!
-    Element_attribute.resize(n_element, 0.0);
+    Vector<double> element_attribute;
 
     // Dummy storage for element numbers
     unsigned dummy_element_number;
 
-    // Resize storage for the global node numbers listed element-by-element
-    Global_node.resize(n_element * n_local_node);
+    // Storage for the global node numbers listed element-by-element
+    Vector<unsigned> element_node(n_element * n_local_node);
 
     // Initialise (global) node counter
     unsigned k = 0;
@@ -105,7 +158,7 @@ namespace oomph
         element_file >> dummy_element_number;
         for (unsigned j = 0; j < n_local_node; j++)
         {
-          element_file >> Global_node[k];
+          element_file >> element_node[k];
           k++;
         }
       }
@@ -113,22 +166,20 @@ namespace oomph
     // Otherwise read in the attributes as well
     else
     {
+      element_attribute.resize(n_element);
       for (unsigned i = 0; i < n_element; i++)
       {
         element_file >> dummy_element_number;
         for (unsigned j = 0; j < n_local_node; j++)
         {
-          element_file >> Global_node[k];
+          element_file >> element_node[k];
           k++;
         }
-        element_file >> Element_attribute[i];
+        element_file >> element_attribute[i];
       }
     }
     element_file.close();
 
-    // Resize the Element vector
-    Element_pt.resize(n_element);
-
     // Process node file
     //--------------------
     std::ifstream node_file(node_file_name.c_str(), std::ios_base::in);
@@ -149,12 +200,6 @@ namespace oomph
     unsigned n_node;
     node_file >> n_node;
 
-    // Create a vector of boolean so as not to create the same node twice
-    std::vector<bool> done(n_node, false);
-
-    // Resize the Node vector
-    Node_pt.resize(n_node);
-
     // Set the spatial dimension of the nodes
     unsigned dimension;
     node_file >> dimension;
@@ -178,88 +223,32 @@ namespace oomph
     // Dummy storage for the node number
     unsigned dummy_node_number;
 
-    // Create storage for nodal positions and boundary markers
-    Vector<double> x_node(n_node);
-    Vector<double> y_node(n_node);
-    Vector<double> z_node(n_node);
-    Vector<unsigned> bound(n_node);
-
-    // Check if there are attributes
-    // If not
-    if (attribute_flag == 0)
+    // Create storage for nodal positions (stored contiguously, node by
+    // node) and boundary markers (only if there are any)
+    Vector<double> node_coordinate(3 * n_node);
+    Vector<unsigned> bound;
+    if (boundary_markers_flag == 1)
     {
-      // Are there boundary markers
-      if (boundary_markers_flag == 1)
-      {
-        for (unsigned i = 0; i < n_node; i++)
-        {
-          node_file >> dummy_node_number;
-          node_file >> x_node[i];
-          node_file >> y_node[i];
-          node_file >> z_node[i];
-          node_file >> bound[i];
-        }
-        node_file.close();
-      }
-      // Otherwise no boundary markers
-      else
-      {
-        for (unsigned i = 0; i < n_node; i++)
-        {
-          node_file >> dummy_node_number;
-          node_file >> x_node[i];
-          node_file >> y_node[i];
-          node_file >> z_node[i];
-          bound[i] = 0;
-        }
-        node_file.close();
-      }
+      bound.resize(n_node);
     }
-    // Otherwise there are attributes
-    else
+
+    // Read the nodes; we ignore the attributes
+    for (unsigned i = 0; i < n_node; i++)
     {
-      if (boundary_markers_flag == 1)
+      node_file >> dummy_node_number;
+      node_file >> node_coordinate[3 * i];
+      node_file >> node_coordinate[3 * i + 1];
+      node_file >> node_coordinate[3 * i + 2];
+      if (attribute_flag != 0)
       {
-        for (unsigned i = 0; i < n_node; i++)
-        {
-          node_file >> dummy_node_number;
-          node_file >> x_node[i];
-          node_file >> y_node[i];
-          node_file >> z_node[i];
-          node_file >> dummy_attribute;
-          node_file >> bound[i];
-        }
-        node_file.close();
-      }
-      else
-      {
-        for (unsigned i = 0; i < n_node; i++)
-        {
-          node_file >> dummy_node_number;
-          node_file >> x_node[i];
-          node_file >> y_node[i];
-          node_file >> z_node[i];
-          node_file >> dummy_attribute;
-          bound[i] = 0;
-        }
-        node_file.close();
+        node_file >> dummy_attribute;
       }
-    }
-
-    // Determine highest boundary index
-    //------------------------------------
-    unsigned n_bound = 0;
-    if (boundary_markers_flag == 1)
-    {
-      n_bound = bound[0];
-      for (unsigned i = 1; i < n_node; i++)
+      if (boundary_markers_flag == 1)
       {
-        if (bound[i] > n_bound)
-        {
-          n_bound = bound[i];
-        }
+        node_file >> bound[i];
       }
     }
+    node_file.close();
 
     // Process face file to extract boundary faces
     //--------------------------------------------
@@ -286,11 +275,9 @@ namespace oomph
     face_file >> boundary_markers_flag;
 
     // Storage for the global node numbers (in the tetgen 1-based
-    // numbering scheme!) of the first, second and third  node in
-    //  each segment
-    Vector<unsigned> first_node(n_face);
-    Vector<unsigned> second_node(n_face);
-    Vector<unsigned> third_node(n_face);
+    // numbering scheme!) of the three nodes on each face, listed
+    // face-by-face
+    Vector<unsigned> face_node(3 * n_face);
 
     // Storage for the boundary marker for each face
     Vector<unsigned> face_boundary(n_face);
@@ -298,416 +285,24 @@ namespace oomph
     // Dummy for global face number
     unsigned dummy_face_number;
 
-    // Storage for the (boundary) faces associated with each node.
-    // Nodes are indexed using Tetgen's 1-based scheme, which is why
-    // there is a +1 here
-    Vector<std::set<unsigned>> node_on_faces(n_node + 1);
-
-    // Extract information for each segment
+    // Extract information for each face
     for (unsigned i = 0; i < n_face; i++)
     {
       face_file >> dummy_face_number;
-      face_file >> first_node[i];
-      face_file >> second_node[i];
-      face_file >> third_node[i];
+      face_file >> face_node[3 * i];
+      face_file >> face_node[3 * i + 1];
+      face_file >> face_node[3 * i + 2];
       face_file >> face_boundary[i];
-      if (face_boundary[i] > n_bound)
-      {
-        n_bound = face_boundary[i];
-      }
-      // Add the face index to each node
-      node_on_faces[first_node[i]].insert(i);
-      node_on_faces[second_node[i]].insert(i);
-      node_on_faces[third_node[i]].insert(i);
     }
     face_file.close();
 
-    // Set number of boundaries
-    if (n_bound > 0)
-    {
-      this->set_nboundary(n_bound);
-    }
-
-    // Create the elements
-    unsigned counter = 0;
-    for (unsigned e = 0; e < n_element; e++)
-    {
-      Element_pt[e] = new TElement<3, 2>;
-      unsigned global_node_number = Global_node[counter];
-      if (done[global_node_number - 1] == false)
-      // ... -1 because node number begins at 1 in tetgen
-      {
-        // If the node is on a boundary, construct a boundary node
-        if ((boundary_markers_flag == 1) && (bound[global_node_number - 1] > 0))
-        {
-          // Construct the boundary ndoe
-          Node_pt[global_node_number - 1] =
-            finite_element_pt(e)->construct_boundary_node(3);
-
-          // Add to the boundary lookup scheme
-          add_boundary_node(bound[global_node_number - 1] - 1,
-                            Node_pt[global_node_number - 1]);
-        }
-        // Otherwise just construct a normal node
-        else
-        {
-          Node_pt[global_node_number - 1] =
-            finite_element_pt(e)->construct_node(3);
-        }
-
-        done[global_node_number - 1] = true;
-        Node_pt[global_node_number - 1]->x(0) = x_node[global_node_number - 1];
-        Node_pt[global_node_number - 1]->x(1) = y_node[global_node_number - 1];
-        Node_pt[global_node_number - 1]->x(2) = z_node[global_node_number - 1];
-      }
-      // Otherwise just copy the node numbr accross
-      else
-      {
-        finite_element_pt(e)->node_pt(3) = Node_pt[global_node_number - 1];
-      }
-      counter++;
-
-      // Loop over the other nodes
-      for (unsigned j = 0; j < (n_local_node - 1); j++)
-      {
-        global_node_number = Global_node[counter];
-        if (done[global_node_number - 1] == false)
-        // ... -1 because node number begins at 1 in tetgen
-        {
-          // If we're on a boundary
-          if ((boundary_markers_flag == 1) &&
-              (bound[global_node_number - 1] > 0))
-          {
-            // Construct the boundary ndoe
-            Node_pt[global_node_number - 1] =
-              finite_element_pt(e)->construct_boundary_node(j);
-
-            // Add to the boundary lookup scheme
-            add_boundary_node(bound[global_node_number - 1] - 1,
-                              Node_pt[global_node_number - 1]);
-          }
-          else
-          {
-            Node_pt[global_node_number - 1] =
-              finite_element_pt(e)->construct_node(j);
-          }
-          done[global_node_number - 1] = true;
-          Node_pt[global_node_number - 1]->x(0) =
-            x_node[global_node_number - 1];
-          Node_pt[global_node_number - 1]->x(1) =
-            y_node[global_node_number - 1];
-          Node_pt[global_node_number - 1]->x(2) =
-            z_node[global_node_number - 1];
-        }
-        // Otherwise copy the pointer over
-        else
-        {
-          finite_element_pt(e)->node_pt(j) = Node_pt[global_node_number - 1];
-        }
-        counter++;
-      }
-    }
-
-
-    // Resize the "matrix" that stores the boundary id for each
-    // face in each element.
-    Face_boundary.resize(n_element);
-    Face_index.resize(n_element);
-    Edge_index.resize(n_element);
-
-
-    // 0-based index scheme used to construct a global lookup for
-    // each face that will be used to uniquely construct interior
-    // face nodes.
-    // The faces that lie on boundaries will have already been allocated so
-    // we can start from there
-    Nglobal_face = n_face;
-
-    // Storage for the edges associated with each node.
-    // Nodes are indexed using Tetgen's 1-based scheme, which is why
-    // there is a +1 here
-    Vector<std::set<unsigned>> node_on_edges(n_node + 1);
-
-    // 0-based index scheme used to construct a global lookup for each
-    // edge that will be used to uniquely construct interior edge nodes
-    Nglobal_edge = 0;
-
-    // Conversion from the edge numbers to the nodes at the end
-    // of each each edge
-    const unsigned first_local_edge_node[6] = {0, 0, 0, 1, 2, 1};
-    const unsigned second_local_edge_node[6] = {1, 2, 3, 2, 3, 3};
-
-    // Loop over the elements
-    for (unsigned e = 0; e < n_element; e++)
-    {
-      // Each element has four faces
-      Face_boundary[e].resize(4);
-      Face_index[e].resize(4);
-      // By default each face is NOT on a boundary
-      for (unsigned i = 0; i < 4; i++)
-      {
-        Face_boundary[e][i] = 0;
-      }
-
-      Edge_index[e].resize(6);
-
-      // Read out the global node numbers of the nodes from
-      // tetgen's 1-based numbering.
-      // The offset is to match the offset used above
-      const unsigned element_offset = e * n_local_node;
-      unsigned glob_num[4] = {0, 0, 0, 0};
-      for (unsigned i = 0; i < 4; ++i)
-      {
-        glob_num[i] = Global_node[element_offset + ((i + 1) % 4)];
-      }
-
-      // Now we know the global node numbers of the elements' four nodes
-      // in tetgen's 1-based numbering.
-
-      // Determine whether any of the element faces have already been allocated
-      // an index. This may be because they are located on boundaries, or have
-      // already been visited The global index for the i-th face will be stored
-      // in Face_index[i]
-
-      // Loop over the local faces in the element
-      for (unsigned i = 0; i < 4; ++i)
-      {
-        // On the i-th face, our numbering convention is such that
-        // it is the (3-i)th node of the element that is omitted
-        const unsigned omitted_node = 3 - i;
-
-        // Start with the set of global faces associated with the i-th node
-        // which is always on the i-th face
-        std::set<unsigned> input = node_on_faces[glob_num[i]];
-
-        // If there is no data yet, not point doing intersections
-        // the face has not been set up
-        if (input.size() > 0)
-        {
-          // Loop over the other nodes on the face
-          unsigned local_node = i;
-          for (unsigned i2 = 0; i2 < 3; ++i2)
-          {
-            // Create the next node index (mod 4)
-            local_node = (local_node + 1) % 4;
-            // Only take the intersection of nodes on the face
-            // i.e. not 3-i
-            if (local_node != omitted_node)
-            {
-              // Local storage for the intersection
-              std::set<unsigned> intersection_result;
-              // Calculate the intersection of the current input
-              // and next node
-              std::set_intersection(
-                input.begin(),
-                input.end(),
-                node_on_faces[glob_num[local_node]].begin(),
-                node_on_faces[glob_num[local_node]].end(),
-                std::insert_iterator<std::set<unsigned>>(
-                  intersection_result, intersection_result.begin()));
-              // Let the result be the next input
-              input = intersection_result;
-            }
-          }
-        }
-
-        // If the nodes share more than one global face index, then
-        // we have a problem
-        if (input.size() > 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh share more than one global face",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-
-        // If the element's face is not already allocated, the intersection
-        // will be empty
-        if (input.size() == 0)
-        {
-          // Allocate the next global index
-          Face_index[e][i] = Nglobal_face;
-          // Associate the new face index with the nodes
-          for (unsigned i2 = 0; i2 < 4; ++i2)
-          {
-            // Don't add the omitted node
-            if (i2 != omitted_node)
-            {
-              node_on_faces[glob_num[i2]].insert(Nglobal_face);
-            }
-          }
-          // Increment the global face index
-          ++Nglobal_face;
-        }
-        // Otherwise we already have a face
-        else if (input.size() == 1)
-        {
-          const unsigned global_face_index = *input.begin();
-          // Set the face index
-          Face_index[e][i] = global_face_index;
-          // Allocate the boundary index, if it's a boundary
-          if (global_face_index < n_face)
-          {
-            Face_boundary[e][i] = face_boundary[global_face_index];
-            // Add the nodes to the boundary look-up scheme in
-            // oomph-lib (0-based) index
-            for (unsigned i2 = 0; i2 < 4; ++i2)
-            {
-              // Don't add the omitted node
-              if (i2 != omitted_node)
-              {
-                add_boundary_node(face_boundary[global_face_index] - 1,
-                                  Node_pt[glob_num[i2] - 1]);
-              }
-            }
-          }
-        }
-      } // end of loop over the faces
-
-
-      // Loop over the element edges and assign global edge numbers
-      for (unsigned i = 0; i < 6; ++i)
-      {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        const unsigned first_global_num = glob_num[first_local_edge_node[i]];
-        const unsigned second_global_num = glob_num[second_local_edge_node[i]];
-
-        // Find the common global edge index for the nodes on
-        // the i-th element edge
-        std::set_intersection(node_on_edges[first_global_num].begin(),
-                              node_on_edges[first_global_num].end(),
-                              node_on_edges[second_global_num].begin(),
-                              node_on_edges[second_global_num].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes share more than one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() > 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh share more than one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-
-        // If the element's edge is not already allocated, the intersection
-        // will be empty
-        if (local_edge_index.size() == 0)
-        {
-          // Allocate the next global index
-          Edge_index[e][i] = Nglobal_edge;
-          // Associate the new edge index with the nodes
-          node_on_edges[first_global_num].insert(Nglobal_edge);
-          node_on_edges[second_global_num].insert(Nglobal_edge);
-          // Increment the global edge index
-          ++Nglobal_edge;
-        }
-        // Otherwise we already have an edge
-        else if (local_edge_index.size() == 1)
-        {
-          // Set the edge index from the result of the intersection
-          Edge_index[e][i] = local_edge_index[0];
-        }
-      }
-
-    } // end for e
-
-
-    // Now determine whether any edges lie on boundaries by using the
-    // face boundary scheme and
-
-    // Resize the storage
-    Edge_boundary.resize(Nglobal_edge, false);
-
-    // Now loop over all the boundary faces and mark that all edges
-    // must also lie on the bounadry
-    for (unsigned i = 0; i < n_face; ++i)
-    {
-      {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        // Find the common global edge index for first edge of the face
-        std::set_intersection(node_on_edges[first_node[i]].begin(),
-                              node_on_edges[first_node[i]].end(),
-                              node_on_edges[second_node[i]].begin(),
-                              node_on_edges[second_node[i]].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes do not share exactly one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() != 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh face do not share exactly one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-        else
-        {
-          Edge_boundary[local_edge_index[0]] = true;
-        }
-      }
-
-      {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        // Find the common global edge index for second edge of the face
-        std::set_intersection(node_on_edges[second_node[i]].begin(),
-                              node_on_edges[second_node[i]].end(),
-                              node_on_edges[third_node[i]].begin(),
-                              node_on_edges[third_node[i]].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes do not share exactly one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() != 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh face do not share exactly one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-        else
-        {
-          Edge_boundary[local_edge_index[0]] = true;
-        }
-      }
-
-      {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        // Find the common global edge index for third edge of the face
-        std::set_intersection(node_on_edges[first_node[i]].begin(),
-                              node_on_edges[first_node[i]].end(),
-                              node_on_edges[third_node[i]].begin(),
-                              node_on_edges[third_node[i]].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes do not share exactly one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() != 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh face do not share exactly one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-        else
-        {
-          Edge_boundary[local_edge_index[0]] = true;
-        }
-      }
-    }
-
+    // Now build the mesh
+    build_from_arrays(node_coordinate,
+                      bound,
+                      element_node,
+                      element_attribute,
+                      face_node,
+                      face_boundary);
 
   } // end of constructor
 
@@ -741,180 +336,240 @@ namespace oomph
         error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
     }
 
+    // Global node numbers listed element-by-element
+    const unsigned n_element_node = n_element * n_local_node;
+    Vector<unsigned> element_node(n_element_node);
+    for (unsigned k = 0; k < n_element_node; k++)
+    {
+      element_node[k] = static_cast<unsigned>(tetgen_data.tetrahedronlist[k]);
+    }
+
     // Element attributes may be used to distinguish internal regions
     // NOTE: This stores doubles because tetgen forces us to!
-    Element_attribute.resize(n_element, 0.0);
+    Vector<double> element_attribute;
+    if (tetgen_data.numberoftetrahedronattributes != 0)
+    {
+      element_attribute.resize(n_element);
+      for (unsigned i = 0; i < n_element; i++)
+      {
+        element_attribute[i] = tetgen_data.tetrahedronattributelist[i];
+      }
+    }
 
-    // Resize storage for the global node numbers listed element-by-element
-    Global_node.resize(n_element * n_local_node);
+    // Read in the number of nodes
+    unsigned n_node = tetgen_data.numberofpoints;
 
-    // Initialise (global) node counter
-    unsigned k = 0;
-    // Are there attributes?
-    unsigned attribute_flag =
-      static_cast<unsigned>(tetgen_data.numberoftetrahedronattributes);
+    // Nodal positions are already stored contiguously; we shall ignore
+    // all point attributes
+    Vector<double> node_coordinate;
+    node_coordinate.assign(tetgen_data.pointlist,
+                           tetgen_data.pointlist + 3 * n_node);
 
-    // Read global node numbers for all elements
-    if (attribute_flag == 0)
+    // Boundary markers (if any)
+    Vector<unsigned> bound;
+    if (tetgen_data.pointmarkerlist != 0)
     {
-      for (unsigned i = 0; i < n_element; i++)
+      bound.resize(n_node);
+      for (unsigned i = 0; i < n_node; i++)
       {
-        for (unsigned j = 0; j < n_local_node; j++)
-        {
-          Global_node[k] =
-            static_cast<unsigned>(tetgen_data.tetrahedronlist[k]);
-          k++;
-        }
+        bound[i] = static_cast<unsigned>(tetgen_data.pointmarkerlist[i]);
       }
     }
-    // Otherwise read in the attributes as well
-    else
+
+    // Now extract face information
+    //---------------------------------
+
+    // Number of faces in face file
+    unsigned n_face = tetgen_data.numberoftrifaces;
+
+    // Storage for the global node numbers (in the tetgen 1-based
+    // numbering scheme!) of the three nodes on each face, listed
+    // face-by-face
+    Vector<unsigned> face_node(3 * n_face);
+
+    // Storage for the boundary marker for each face
+    Vector<unsigned> face_boundary(n_face);
+
+    // Extract information for each face
+    for (unsigned i = 0; i < n_face; i++)
     {
-      for (unsigned i = 0; i < n_element; i++)
+      for (unsigned j = 0; j < 3; j++)
       {
-        for (unsigned j = 0; j < n_local_node; j++)
-        {
-          Global_node[k] =
-            static_cast<unsigned>(tetgen_data.tetrahedronlist[k]);
-          k++;
-        }
-        Element_attribute[i] = tetgen_data.tetrahedronattributelist[i];
+        face_node[3 * i + j] =
+          static_cast<unsigned>(tetgen_data.trifacelist[3 * i + j]);
       }
+      face_boundary[i] =
+        static_cast<unsigned>(tetgen_data.trifacemarkerlist[i]);
     }
 
-    // Resize the Element vector
-    Element_pt.resize(n_element);
+    // Now build the mesh
+    build_from_arrays(node_coordinate,
+                      bound,
+                      element_node,
+                      element_attribute,
+                      face_node,
+                      face_boundary);
+  }
 
-    // Read in the number of nodes
-    unsigned n_node = tetgen_data.numberofpoints;
 
-    // Create a vector of boolean so as not to create the same node twice
-    std::vector<bool> done(n_node, false);
+  //======================================================================
+  /// Constructor: Pass the mesh data directly as contiguous arrays
+  /// (see build_from_arrays(...) for the layout). This avoids writing
+  /// the mesh to tetgen's node/element/face files only to parse them
+  /// again.
+  //======================================================================
+  TetgenScaffoldMesh::TetgenScaffoldMesh(
+    const Vector<double>& node_coordinate,
+    const Vector<unsigned>& node_boundary,
+    const Vector<unsigned>& element_node,
+    const Vector<double>& element_attribute,
+    const Vector<unsigned>& face_node,
+    const Vector<unsigned>& face_boundary)
+  {
+    build_from_arrays(node_coordinate,
+                      node_boundary,
+                      element_node,
+                      element_attribute,
+                      face_node,
+                      face_boundary);
+  }
 
-    // Resize the Node vector
-    Node_pt.resize(n_node);
 
-    // Flag for boundary markers
-    unsigned boundary_markers_flag = 0;
-    if (tetgen_data.pointmarkerlist != 0)
+  //======================================================================
+  /// \short Build the scaffold mesh from contiguous arrays in a single
+  /// pass over the elements. Global face and edge numbers are
+  /// established via hashed look-ups keyed by the (sorted) global node
+  /// numbers of the face/edge.
+  //======================================================================
+  void TetgenScaffoldMesh::build_from_arrays(
+    const Vector<double>& node_coordinate,
+    const Vector<unsigned>& node_boundary,
+    const Vector<unsigned>& element_node,
+    const Vector<double>& element_attribute,
+    const Vector<unsigned>& face_node,
+    const Vector<unsigned>& face_boundary)
+  {
+    // Tetgen only produces 4-noded tetrahedra
+    const unsigned n_local_node = 4;
+
+    // Number of nodes, elements and (boundary) faces
+    const unsigned n_node = node_coordinate.size() / 3;
+    const unsigned n_element = element_node.size() / n_local_node;
+    const unsigned n_face = face_boundary.size();
+
+    // Do we have boundary markers for the nodes?
+    const bool have_node_boundary = !node_boundary.empty();
+
+#ifdef PARANOID
+    if (node_coordinate.size() != 3 * n_node)
+    {
+      std::ostringstream error_stream;
+      error_stream << "Size of node_coordinate, " << node_coordinate.size()
+                   << ", is not a multiple of the spatial dimension, 3\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+    if (element_node.size() != n_local_node * n_element)
     {
-      boundary_markers_flag = 1;
+      std::ostringstream error_stream;
+      error_stream << "Size of element_node, " << element_node.size()
+                   << ", is not a multiple of the number of nodes per "
+                   << "element, " << n_local_node << "\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
     }
+    if (have_node_boundary && (node_boundary.size() != n_node))
+    {
+      std::ostringstream error_stream;
+      error_stream << "node_boundary must either be empty or have one "
+                   << "entry per node (" << n_node << "), but it has "
+                   << node_boundary.size() << " entries\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+    if (!element_attribute.empty() && (element_attribute.size() != n_element))
+    {
+      std::ostringstream error_stream;
+      error_stream << "element_attribute must either be empty or have one "
+                   << "entry per element (" << n_element << "), but it has "
+                   << element_attribute.size() << " entries\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+    if (face_node.size() != 3 * n_face)
+    {
+      std::ostringstream error_stream;
+      error_stream << "Size of face_node, " << face_node.size()
+                   << ", should be three times the number of boundary "
+                   << "faces, " << n_face << "\n";
+      throw OomphLibError(
+        error_stream.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+#endif
 
-    // Create storage for nodal positions and boundary markers
-    Vector<double> x_node(n_node);
-    Vector<double> y_node(n_node);
-    Vector<double> z_node(n_node);
-    Vector<unsigned> bound(n_node);
+    // Store the global node numbers listed element-by-element
+    Global_node = element_node;
 
-    // We shall ignore all point attributes
-    if (boundary_markers_flag == 1)
+    // Element attributes may be used to distinguish internal regions
+    // NOTE: This stores doubles because tetgen forces us to!
+    if (element_attribute.empty())
     {
-      for (unsigned i = 0; i < n_node; i++)
-      {
-        x_node[i] = tetgen_data.pointlist[3 * i];
-        y_node[i] = tetgen_data.pointlist[3 * i + 1];
-        z_node[i] = tetgen_data.pointlist[3 * i + 2];
-        bound[i] = static_cast<unsigned>(tetgen_data.pointmarkerlist[i]);
-      }
+      Element_attribute.assign(n_element, 0.0);
     }
-    // Otherwise no boundary markers
     else
     {
-      for (unsigned i = 0; i < n_node; i++)
-      {
-        x_node[i] = tetgen_data.pointlist[3 * i];
-        y_node[i] = tetgen_data.pointlist[3 * i + 1];
-        z_node[i] = tetgen_data.pointlist[3 * i + 2];
-        bound[i] = 0;
-      }
+      Element_attribute = element_attribute;
     }
 
+    // Resize the Element vector
+    Element_pt.resize(n_element);
+
+    // Create a vector of boolean so as not to create the same node twice
+    std::vector<bool> done(n_node, false);
+
+    // Resize the Node vector
+    Node_pt.resize(n_node);
 
     // Determine highest boundary index
     //------------------------------------
     unsigned n_bound = 0;
-    if (boundary_markers_flag == 1)
+    if (have_node_boundary)
     {
-      n_bound = bound[0];
-      for (unsigned i = 1; i < n_node; i++)
+      for (unsigned i = 0; i < n_node; i++)
       {
-        if (bound[i] > n_bound)
+        if (node_boundary[i] > n_bound)
         {
-          n_bound = bound[i];
+          n_bound = node_boundary[i];
         }
       }
     }
 
-    // Now extract face information
-    //---------------------------------
-
-    // Number of faces in face file
-    unsigned n_face = tetgen_data.numberoftrifaces;
-
-    // Storage for the global node numbers (in the tetgen 1-based
-    // numbering scheme!) of the first, second and third  node in
-    //  each segment
-    Vector<unsigned> first_node(n_face);
-    Vector<unsigned> second_node(n_face);
-    Vector<unsigned> third_node(n_face);
-
-    // Storage for the boundary marker for each face
-    Vector<unsigned> face_boundary(n_face);
-
-    // Storage for the (boundary) faces associated with each node.
-    // Nodes are indexed using Tetgen's 1-based scheme, which is why
-    // there is a +1 here
-    Vector<std::set<unsigned>> node_on_faces(n_node + 1);
-
-    // Extract information for each segment
+    // Hashed look-up for the global face index from the global node
+    // numbers (in tetgen's 1-based scheme) of the nodes on the face.
+    // The boundary faces are entered first, so they retain the index
+    // used in the face list.
+    std::unordered_map<FaceKey, unsigned, FaceKeyHash> global_face_index;
+    global_face_index.reserve(n_face + 2 * n_element);
     for (unsigned i = 0; i < n_face; i++)
     {
-      first_node[i] = static_cast<unsigned>(tetgen_data.trifacelist[3 * i]);
-      second_node[i] =
-        static_cast<unsigned>(tetgen_data.trifacelist[3 * i + 1]);
-      third_node[i] = static_cast<unsigned>(tetgen_data.trifacelist[3 * i + 2]);
-      face_boundary[i] =
-        static_cast<unsigned>(tetgen_data.trifacemarkerlist[i]);
       if (face_boundary[i] > n_bound)
       {
         n_bound = face_boundary[i];
       }
-      // Add the face index to each node
-      node_on_faces[first_node[i]].insert(i);
-      node_on_faces[second_node[i]].insert(i);
-      node_on_faces[third_node[i]].insert(i);
+      if (!global_face_index
+             .insert(std::make_pair(face_key(face_node[3 * i],
+                                             face_node[3 * i + 1],
+                                             face_node[3 * i + 2]),
+                                    i))
+             .second)
+      {
+        throw OomphLibError(
+          "Nodes in scaffold mesh share more than one global face",
+          OOMPH_CURRENT_FUNCTION,
+          OOMPH_EXCEPTION_LOCATION);
+      }
     }
 
-    // Extract hole center information
-    // unsigned nhole=tetgen_data.numberofholes;
-    /*if(nhole!=0)
-     {
-      Hole_centre.resize(nhole);
-
-      // Coords counter
-      unsigned count_coords=0;
-
-      // Loop over the holes to get centre coords
-      for(unsigned ihole=0;ihole<nhole;ihole++)
-       {
-        Hole_centre[ihole].resize(3);
-
-        // Read the centre value
-        Hole_centre[ihole][0]=triangle_data.holelist[count_coords];
-        Hole_centre[ihole][1]=triangle_data.holelist[count_coords+1];
-        Hole_centre[ihole][2]=triangle_data.holelist[count_coords+2];
-
-        // Increment coords counter
-        count_coords+=3;
-       }
-     }
-    else
-     {
-      Hole_centre.resize(0);
-      }*/
-
-
     // Set number of boundaries
     if (n_bound > 0)
     {
@@ -926,76 +581,40 @@ namespace oomph
     for (unsigned e = 0; e < n_element; e++)
     {
       Element_pt[e] = new TElement<3, 2>;
-      unsigned global_node_number = Global_node[counter];
-      if (done[global_node_number - 1] == false)
-      // ... -1 because node number begins at 1 in tetgen
-      {
-        // If the node is on a boundary, construct a boundary node
-        if ((boundary_markers_flag == 1) && (bound[global_node_number - 1] > 0))
-        {
-          // Construct the boundary ndoe
-          Node_pt[global_node_number - 1] =
-            finite_element_pt(e)->construct_boundary_node(3);
-
-          // Add to the boundary lookup scheme
-          add_boundary_node(bound[global_node_number - 1] - 1,
-                            Node_pt[global_node_number - 1]);
-        }
-        // Otherwise just construct a normal node
-        else
-        {
-          Node_pt[global_node_number - 1] =
-            finite_element_pt(e)->construct_node(3);
-        }
 
-        done[global_node_number - 1] = true;
-        Node_pt[global_node_number - 1]->x(0) = x_node[global_node_number - 1];
-        Node_pt[global_node_number - 1]->x(1) = y_node[global_node_number - 1];
-        Node_pt[global_node_number - 1]->x(2) = z_node[global_node_number - 1];
-      }
-      // Otherwise just copy the node numbr accross
-      else
+      // Tetgen's first node is the element's last (local) node
+      for (unsigned i = 0; i < n_local_node; i++)
       {
-        finite_element_pt(e)->node_pt(3) = Node_pt[global_node_number - 1];
-      }
-      counter++;
+        const unsigned j = (i + n_local_node - 1) % n_local_node;
 
-      // Loop over the other nodes
-      for (unsigned j = 0; j < (n_local_node - 1); j++)
-      {
-        global_node_number = Global_node[counter];
-        if (done[global_node_number - 1] == false)
         // ... -1 because node number begins at 1 in tetgen
+        const unsigned n = Global_node[counter] - 1;
+        if (done[n] == false)
         {
-          // If we're on a boundary
-          if ((boundary_markers_flag == 1) &&
-              (bound[global_node_number - 1] > 0))
+          // If the node is on a boundary, construct a boundary node
+          if (have_node_boundary && (node_boundary[n] > 0))
           {
-            // Construct the boundary ndoe
-            Node_pt[global_node_number - 1] =
-              finite_element_pt(e)->construct_boundary_node(j);
+            // Construct the boundary node
+            Node_pt[n] = finite_element_pt(e)->construct_boundary_node(j);
 
             // Add to the boundary lookup scheme
-            add_boundary_node(bound[global_node_number - 1] - 1,
-                              Node_pt[global_node_number - 1]);
+            add_boundary_node(node_boundary[n] - 1, Node_pt[n]);
           }
+          // Otherwise just construct a normal node
           else
           {
-            Node_pt[global_node_number - 1] =
-              finite_element_pt(e)->construct_node(j);
+            Node_pt[n] = finite_element_pt(e)->construct_node(j);
           }
-          done[global_node_number - 1] = true;
-          Node_pt[global_node_number - 1]->x(0) =
-            x_node[global_node_number - 1];
-          Node_pt[global_node_number - 1]->x(1) =
-            y_node[global_node_number - 1];
-          Node_pt[global_node_number - 1]->x(2) =
-            z_node[global_node_number - 1];
+
+          done[n] = true;
+          Node_pt[n]->x(0) = node_coordinate[3 * n];
+          Node_pt[n]->x(1) = node_coordinate[3 * n + 1];
+          Node_pt[n]->x(2) = node_coordinate[3 * n + 2];
         }
         // Otherwise copy the pointer over
         else
         {
-          finite_element_pt(e)->node_pt(j) = Node_pt[global_node_number - 1];
+          finite_element_pt(e)->node_pt(j) = Node_pt[n];
         }
         counter++;
       }
@@ -1016,10 +635,10 @@ namespace oomph
     // we can start from there
     Nglobal_face = n_face;
 
-    // Storage for the edges associated with each node.
-    // Nodes are indexed using Tetgen's 1-based scheme, which is why
-    // there is a +1 here
-    Vector<std::set<unsigned>> node_on_edges(n_node + 1);
+    // Hashed look-up for the global edge index from the global node
+    // numbers (in tetgen's 1-based scheme) of the nodes at its ends
+    std::unordered_map<unsigned long long, unsigned> global_edge_index;
+    global_edge_index.reserve(n_node + n_face + n_element);
 
     // 0-based index scheme used to construct a global lookup for each
     // edge that will be used to uniquely construct interior edge nodes
@@ -1057,11 +676,6 @@ namespace oomph
       // Now we know the global node numbers of the elements' four nodes
       // in tetgen's 1-based numbering.
 
-      // Determine whether any of the element faces have already been allocated
-      // an index. This may be because they are located on boundaries, or have
-      // already been visited The global index for the i-th face will be stored
-      // in Face_index[i]
-
       // Loop over the local faces in the element
       for (unsigned i = 0; i < 4; ++i)
       {
@@ -1069,73 +683,36 @@ namespace oomph
         // it is the (3-i)th node of the element that is omitted
         const unsigned omitted_node = 3 - i;
 
-        // Start with the set of global faces associated with the i-th node
-        // which is always on the i-th face
-        std::set<unsigned> input = node_on_faces[glob_num[i]];
-
-        // If there is no data yet, not point doing intersections
-        // the face has not been set up
-        if (input.size() > 0)
+        // Global node numbers of the nodes on the face
+        unsigned face_glob_num[3];
+        unsigned count = 0;
+        for (unsigned i2 = 0; i2 < 4; ++i2)
         {
-          // Loop over the other nodes on the face
-          unsigned local_node = i;
-          for (unsigned i2 = 0; i2 < 3; ++i2)
+          if (i2 != omitted_node)
           {
-            // Create the next node index (mod 4)
-            local_node = (local_node + 1) % 4;
-            // Only take the intersection of nodes on the face
-            // i.e. not 3-i
-            if (local_node != omitted_node)
-            {
-              // Local storage for the intersection
-              std::set<unsigned> intersection_result;
-              // Calculate the intersection of the current input
-              // and next node
-              std::set_intersection(
-                input.begin(),
-                input.end(),
-                node_on_faces[glob_num[local_node]].begin(),
-                node_on_faces[glob_num[local_node]].end(),
-                std::insert_iterator<std::set<unsigned>>(
-                  intersection_result, intersection_result.begin()));
-              // Let the result be the next input
-              input = intersection_result;
-            }
+            face_glob_num[count++] = glob_num[i2];
           }
         }
 
-        // If the nodes share more than one global face index, then
-        // we have a problem
-        if (input.size() > 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh share more than one global face",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
+        // Look up the face; if it hasn't been visited yet, it gets
+        // the next global index
+        std::pair<std::unordered_map<FaceKey, unsigned, FaceKeyHash>::iterator,
+                  bool>
+          result = global_face_index.insert(std::make_pair(
+            face_key(face_glob_num[0], face_glob_num[1], face_glob_num[2]),
+            Nglobal_face));
 
-        // If the element's face is not already allocated, the intersection
-        // will be empty
-        if (input.size() == 0)
+        // If the element's face was not already allocated, we've just
+        // allocated the next global index
+        if (result.second)
         {
-          // Allocate the next global index
           Face_index[e][i] = Nglobal_face;
-          // Associate the new face index with the nodes
-          for (unsigned i2 = 0; i2 < 4; ++i2)
-          {
-            // Don't add the omitted node
-            if (i2 != omitted_node)
-            {
-              node_on_faces[glob_num[i2]].insert(Nglobal_face);
-            }
-          }
-          // Increment the global face index
           ++Nglobal_face;
         }
         // Otherwise we already have a face
-        else if (input.size() == 1)
+        else
         {
-          const unsigned global_face_index = *input.begin();
+          const unsigned global_face_index = result.first->second;
           // Set the face index
           Face_index[e][i] = global_face_index;
           // Allocate the boundary index, if it's a boundary
@@ -1144,14 +721,10 @@ namespace oomph
             Face_boundary[e][i] = face_boundary[global_face_index];
             // Add the nodes to the boundary look-up scheme in
             // oomph-lib (0-based) index
-            for (unsigned i2 = 0; i2 < 4; ++i2)
+            for (unsigned i2 = 0; i2 < 3; ++i2)
             {
-              // Don't add the omitted node
-              if (i2 != omitted_node)
-              {
-                add_boundary_node(face_boundary[global_face_index] - 1,
-                                  Node_pt[glob_num[i2] - 1]);
-              }
+              add_boundary_node(face_boundary[global_face_index] - 1,
+                                Node_pt[face_glob_num[i2] - 1]);
             }
           }
         }
@@ -1161,148 +734,57 @@ namespace oomph
       // Loop over the element edges and assign global edge numbers
       for (unsigned i = 0; i < 6; ++i)
       {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        const unsigned first_global_num = glob_num[first_local_edge_node[i]];
-        const unsigned second_global_num = glob_num[second_local_edge_node[i]];
-
-        // Find the common global edge index for the nodes on
-        // the i-th element edge
-        std::set_intersection(node_on_edges[first_global_num].begin(),
-                              node_on_edges[first_global_num].end(),
-                              node_on_edges[second_global_num].begin(),
-                              node_on_edges[second_global_num].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes share more than one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() > 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh share more than one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
+        // Look up the edge; if it hasn't been visited yet, it gets
+        // the next global index
+        std::pair<std::unordered_map<unsigned long long, unsigned>::iterator,
+                  bool>
+          result = global_edge_index.insert(
+            std::make_pair(edge_key(glob_num[first_local_edge_node[i]],
+                                    glob_num[second_local_edge_node[i]]),
+                           Nglobal_edge));
+
+        // Set the edge index
+        Edge_index[e][i] = result.first->second;
 
-        // If the element's edge is not already allocated, the intersection
-        // will be empty
-        if (local_edge_index.size() == 0)
+        // Increment the global edge index if we've just allocated it
+        if (result.second)
         {
-          // Allocate the next global index
-          Edge_index[e][i] = Nglobal_edge;
-          // Associate the new edge index with the nodes
-          node_on_edges[first_global_num].insert(Nglobal_edge);
-          node_on_edges[second_global_num].insert(Nglobal_edge);
-          // Increment the global edge index
           ++Nglobal_edge;
         }
-        // Otherwise we already have an edge
-        else if (local_edge_index.size() == 1)
-        {
-          // Set the edge index from the result of the intersection
-          Edge_index[e][i] = local_edge_index[0];
-        }
       }
 
     } // end for e
 
 
     // Now determine whether any edges lie on boundaries by using the
-    // face boundary scheme and
+    // face boundary scheme
 
     // Resize the storage
     Edge_boundary.resize(Nglobal_edge, false);
 
     // Now loop over all the boundary faces and mark that all edges
-    // must also lie on the bounadry
+    // must also lie on the boundary
     for (unsigned i = 0; i < n_face; ++i)
     {
+      for (unsigned j = 0; j < 3; ++j)
       {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        // Find the common global edge index for first edge of the face
-        std::set_intersection(node_on_edges[first_node[i]].begin(),
-                              node_on_edges[first_node[i]].end(),
-                              node_on_edges[second_node[i]].begin(),
-                              node_on_edges[second_node[i]].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes do not share exactly one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() != 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh face do not share exactly one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-        else
-        {
-          Edge_boundary[local_edge_index[0]] = true;
-        }
-      }
-
-      {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        // Find the common global edge index for second edge of the face
-        std::set_intersection(node_on_edges[second_node[i]].begin(),
-                              node_on_edges[second_node[i]].end(),
-                              node_on_edges[third_node[i]].begin(),
-                              node_on_edges[third_node[i]].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
-
-        // If the nodes do not share exactly one global edge index, then
-        // we have a problem
-        if (local_edge_index.size() != 1)
-        {
-          throw OomphLibError(
-            "Nodes in scaffold mesh face do not share exactly one global edge",
-            OOMPH_CURRENT_FUNCTION,
-            OOMPH_EXCEPTION_LOCATION);
-        }
-        else
-        {
-          Edge_boundary[local_edge_index[0]] = true;
-        }
-      }
-
-      {
-        // Storage for the result of the intersection
-        std::vector<unsigned> local_edge_index;
-
-        // Find the common global edge index for third edge of the face
-        std::set_intersection(node_on_edges[first_node[i]].begin(),
-                              node_on_edges[first_node[i]].end(),
-                              node_on_edges[third_node[i]].begin(),
-                              node_on_edges[third_node[i]].end(),
-                              std::insert_iterator<std::vector<unsigned>>(
-                                local_edge_index, local_edge_index.begin()));
+        std::unordered_map<unsigned long long, unsigned>::const_iterator it =
+          global_edge_index.find(
+            edge_key(face_node[3 * i + j], face_node[3 * i + (j + 1) % 3]));
 
         // If the nodes do not share exactly one global edge index, then
         // we have a problem
-        if (local_edge_index.size() != 1)
+        if (it == global_edge_index.end())
         {
           throw OomphLibError(
             "Nodes in scaffold mesh face do not share exactly one global edge",
             OOMPH_CURRENT_FUNCTION,
             OOMPH_EXCEPTION_LOCATION);
         }
-        else
-        {
-          Edge_boundary[local_edge_index[0]] = true;
-        }
+        Edge_boundary[it->second] = true;
       }
     }
 
-
-  } // end of constructor
-
+  } // end of build_from_arrays
 
 } // namespace oomph
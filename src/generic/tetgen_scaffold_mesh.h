@@ -53,6 +53,15 @@ namespace oomph
     /// \short Constructor using direct tetgenio object
     TetgenScaffoldMesh(tetgenio& tetgen_data);
 
+    /// \short Constructor from contiguous arrays, bypassing tetgen's
+    /// files and data structure; see build_from_arrays(...) for details.
+    TetgenScaffoldMesh(const Vector<double>& node_coordinate,
+                       const Vector<unsigned>& node_boundary,
+                       const Vector<unsigned>& element_node,
+                       const Vector<double>& element_attribute,
+                       const Vector<unsigned>& face_node,
+                       const Vector<unsigned>& face_boundary);
+
     /// Empty destructor
     ~TetgenScaffoldMesh() {}
 
@@ -116,6 +125,25 @@ namespace oomph
 
 
   protected:
+    /// \short Build the mesh from contiguous arrays. All node numbers
+    /// follow tetgen's 1-based numbering scheme.
+    /// - node_coordinate: x,y,z of the nodes, listed node-by-node.
+    /// - node_boundary: tetgen boundary marker of each node (0 if the
+    ///   node is not on a boundary); may be empty if there are none.
+    /// - element_node: global numbers of the four nodes of the
+    ///   tetrahedra, listed element-by-element.
+    /// - element_attribute: attribute (region ID) of each element; may
+    ///   be empty.
+    /// - face_node: global numbers of the three nodes of the boundary
+    ///   faces, listed face-by-face.
+    /// - face_boundary: tetgen boundary marker of each boundary face.
+    void build_from_arrays(const Vector<double>& node_coordinate,
+                           const Vector<unsigned>& node_boundary,
+                           const Vector<unsigned>& element_node,
+                           const Vector<double>& element_attribute,
+                           const Vector<unsigned>& face_node,
+                           const Vector<unsigned>& face_boundary);
+
     /// \short Storage for the number of global faces
     unsigned Nglobal_face;
 
@@ -418,6 +418,10 @@ namespace oomph
     Vector<Vector<FiniteElement*>> vector_of_boundary_element_pt;
     vector_of_boundary_element_pt.resize(nbound);
 
+    // ...and the same elements as sets, for fast checks whether an
+    // element has already been added to the vector
+    Vector<std::set<FiniteElement*>> set_of_boundary_element_pt(nbound);
+
     // Matrix map for working out the fixed face for elements on boundary
     MapMatrixMixed<unsigned, FiniteElement*, int> face_identifier;
 
@@ -437,10 +441,6 @@ namespace oomph
     MapMatrixMixed<unsigned, FiniteElement*, int> face_count;
     Vector<unsigned> bonus(nbound);
 
-    // When using internal boundaries, an edge can be related to more than
-    // one element (because of both sides of the internal boundaries)
-    std::map<Edge, Vector<TriangleBoundaryHelper::BCInfo>> edge_internal_bnd;
-
     for (unsigned e = 0; e < nel; e++)
     {
       // Get pointer to element
@@ -498,9 +498,6 @@ namespace oomph
 
             // Update edge_bcinfo
             edge_bcinfo.insert(std::make_pair(edge0, info));
-
-            // ... and also update the info associated with internal bnd
-            edge_internal_bnd[edge0].push_back(info);
           }
         }
 
@@ -535,9 +532,6 @@ namespace oomph
 
             // Update edge_bcinfo
             edge_bcinfo.insert(std::make_pair(edge1, info));
-
-            // ... and also update the info associated with internal bnd
-            edge_internal_bnd[edge1].push_back(info);
           }
         }
 
@@ -572,9 +566,6 @@ namespace oomph
 
             // Update edge_bcinfo
             edge_bcinfo.insert(std::make_pair(edge2, info));
-
-            // ... and also update the info associated with internal bnd
-            edge_internal_bnd[edge2].push_back(info);
           }
         }
 
@@ -652,23 +643,16 @@ namespace oomph
         }
         else
         {
-          // Add element and face to the appropriate vectors
-          // Does the pointer already exits in the vector
-          Vector<FiniteElement*>::iterator b_el_it = std::find(
-            vector_of_boundary_element_pt[static_cast<unsigned>(bound)].begin(),
-            vector_of_boundary_element_pt[static_cast<unsigned>(bound)].end(),
-            it->second.FE_pt);
-
-          // Only insert if we have not found it (i.e. got to the end)
-          if (b_el_it ==
-              vector_of_boundary_element_pt[static_cast<unsigned>(bound)].end())
+          // Add element and face to the appropriate vectors, but
+          // only insert the element if it's not been added before
+          if (set_of_boundary_element_pt[static_cast<unsigned>(bound)]
+                .insert(it->second.FE_pt)
+                .second)
           {
             vector_of_boundary_element_pt[static_cast<unsigned>(bound)]
               .push_back(it->second.FE_pt);
           }
 
-          // set_of_boundary_element_pt[static_cast<unsigned>(bound)].insert(
-          // it->second.FE_pt);
           face_identifier(static_cast<unsigned>(bound), it->second.FE_pt) =
             it->second.Face_id;
         }
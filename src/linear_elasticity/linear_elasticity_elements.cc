@@ -237,6 +237,30 @@ namespace oomph
     // Integer to store the local equation number
     int local_eqn = 0, local_unknown = 0;
 
+    // The elasticity tensor is the same throughout the element, so get
+    // its entries once, rather than via (virtual) function calls in
+    // the innermost loops below
+    double elasticity_tensor[DIM][DIM][DIM][DIM];
+    for (unsigned a = 0; a < DIM; a++)
+    {
+      for (unsigned b = 0; b < DIM; b++)
+      {
+        for (unsigned c = 0; c < DIM; c++)
+        {
+          for (unsigned d = 0; d < DIM; d++)
+          {
+            elasticity_tensor[a][b][c][d] = this->E(a, b, c, d);
+          }
+        }
+      }
+    }
+
+    // Storage for Eulerian coordinates and body force (passed to the
+    // body force function); allocated once rather than at every
+    // integration point
+    Vector<double> interpolated_x(DIM);
+    Vector<double> b(DIM);
+
     // Loop over the integration points
     for (unsigned ipt = 0; ipt < n_intpt; ipt++)
     {
@@ -252,15 +276,23 @@ namespace oomph
       // Call the derivatives of the shape functions (and get Jacobian)
       double J = this->dshape_eulerian_at_knot(ipt, psi, dpsidx);
 
-      // Storage for Eulerian coordinates (initialised to zero)
-      Vector<double> interpolated_x(DIM, 0.0);
-
       // Calculate interpolated values of the derivative of global position
-      // wrt lagrangian coordinates
-      DenseMatrix<double> interpolated_dudx(DIM, DIM, 0.0);
+      // wrt lagrangian coordinates and the accelerations; DIM is known at
+      // compile time, so these live on the stack
+      double interpolated_dudx[DIM][DIM];
+      double accel[DIM];
 
-      // Setup memory for accelerations (initialised to zero)
-      Vector<double> accel(DIM, 0.0);
+      // Initialise to zero
+      for (unsigned i = 0; i < DIM; i++)
+      {
+        interpolated_x[i] = 0.0;
+        accel[i] = 0.0;
+        b[i] = 0.0;
+        for (unsigned j = 0; j < DIM; j++)
+        {
+          interpolated_dudx[i][j] = 0.0;
+        }
+      }
 
       // Calculate displacements and derivatives and lagrangian coordinates
       for (unsigned l = 0; l < n_node; l++)
@@ -283,13 +315,12 @@ namespace oomph
           // Loop over derivative directions
           for (unsigned j = 0; j < DIM; j++)
           {
-            interpolated_dudx(i, j) += u_value * dpsidx(l, j);
+            interpolated_dudx[i][j] += u_value * dpsidx(l, j);
           }
         }
       }
 
       // Get body force at current time
-      Vector<double> b(DIM);
       this->body_force(interpolated_x, b);
 
       // Premultiply the weights and the Jacobian
@@ -319,8 +350,8 @@ namespace oomph
                 for (unsigned d = 0; d < DIM; d++)
                 {
                   // Add the stress terms to the residuals
-                  residuals[local_eqn] += this->E(a, b, c, d) *
-                                          interpolated_dudx(c, d) *
+                  residuals[local_eqn] += elasticity_tensor[a][b][c][d] *
+                                          interpolated_dudx[c][d] *
                                           dpsidx(l, b) * W;
                 }
               }
@@ -354,8 +385,8 @@ namespace oomph
                       {
                         // Add the contribution to the Jacobian matrix
                         jacobian(local_eqn, local_unknown) +=
-                          this->E(a, b, c, d) * dpsidx(l2, d) * dpsidx(l, b) *
-                          W;
+                          elasticity_tensor[a][b][c][d] * dpsidx(l2, d) *
+                          dpsidx(l, b) * W;
                       }
                     }
                   } // End of if not boundary condition
@@ -82,6 +82,27 @@ namespace oomph
       spine_node_pt->x(1) = this->Ymin + W * H;
     }
 
+    /// \short Spine-ordered node update (see
+    /// SpineMesh::enable_spine_ordered_node_update()): Update all nodes
+    /// on the i-th spine, extracting the spine height only once.
+    void spine_ordered_node_update(const unsigned long& i)
+    {
+      // Get spine height
+      const double H = this->Spine_pt[i]->height();
+      // Loop over the nodes on the spine
+      const unsigned long l_last = this->First_spine_ordered_node_index[i + 1];
+      for (unsigned long l = this->First_spine_ordered_node_index[i];
+           l < l_last;
+           l++)
+      {
+        SpineNode* spine_node_pt = this->Spine_ordered_node_pt[l];
+        // Set the value of y
+        spine_node_pt->x(1) = this->Ymin + spine_node_pt->fraction() * H;
+        // Perform any auxiliary updates
+        spine_node_pt->perform_auxiliary_node_update_fct();
+      }
+    }
+
 
   protected:
     /// \short Helper function to actually build the single-layer spine mesh
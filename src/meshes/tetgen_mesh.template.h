@@ -135,6 +135,56 @@ namespace oomph
     }
 
 
+    /// \short Constructor from contiguous arrays of nodal coordinates,
+    /// element connectivity and boundary faces, as produced in memory
+    /// by an external mesh generator or reader. This builds the mesh
+    /// directly, without writing and re-parsing tetgen's files; see
+    /// TetgenScaffoldMesh::build_from_arrays(...) for the layout of the
+    /// arrays.
+    TetgenMesh(const Vector<double>& node_coordinate,
+               const Vector<unsigned>& node_boundary,
+               const Vector<unsigned>& element_node,
+               const Vector<double>& element_attribute,
+               const Vector<unsigned>& face_node,
+               const Vector<unsigned>& face_boundary,
+               TimeStepper* time_stepper_pt = &Mesh::Default_TimeStepper,
+               const bool& use_attributes = false)
+      : Tetgenio_exists(false), Tetgenio_pt(0)
+    {
+      // Mesh can only be built with 3D Telements.
+      MeshChecker::assert_geometric_element<TElementGeometricBase, ELEMENT>(3);
+
+      // Store the attributes
+      Use_attributes = use_attributes;
+
+      // Store timestepper used to build elements
+      Time_stepper_pt = time_stepper_pt;
+
+      // Build scaffold
+      Tmp_mesh_pt = new TetgenScaffoldMesh(node_coordinate,
+                                           node_boundary,
+                                           element_node,
+                                           element_attribute,
+                                           face_node,
+                                           face_boundary);
+
+      // Convert mesh from scaffold to actual mesh
+      build_from_scaffold(time_stepper_pt, use_attributes);
+
+      // Kill the scaffold
+      delete Tmp_mesh_pt;
+      Tmp_mesh_pt = 0;
+
+      // Setup boundary coordinates
+      unsigned nb = nboundary();
+      for (unsigned b = 0; b < nb; b++)
+      {
+        bool switch_normal = false;
+        setup_boundary_coordinates<ELEMENT>(b, switch_normal);
+      }
+    }
+
+
     /// \short Constructor with the input files. Setting the boolean
     /// flag to true splits "corner" elements, i.e. elements that
     /// that have at least three faces on a domain boundary. The
@@ -29585,6 +29585,254 @@ namespace oomph
     } // for (e < nel)
   }
 
+  //======================================================================
+  /// Helper function for local adaptation: Identify the elements in the
+  /// new mesh that coincide with elements in the current mesh (i.e. the
+  /// ones that were not touched by the local re-meshing) and return them,
+  /// paired with their counterparts in the current mesh, along with the
+  /// map from their nodes to the corresponding nodes in the current mesh.
+  /// All other elements of the new mesh (and their nodes) are added to
+  /// the cavity mesh.
+  //======================================================================
+  template<class ELEMENT>
+  void RefineableTriangleMesh<ELEMENT>::identify_untouched_elements(
+    Mesh* new_mesh_pt,
+    Vector<std::pair<FiniteElement*, FiniteElement*>>& untouched_element_pt,
+    std::map<Node*, Node*>& old_node_pt,
+    Mesh* cavity_mesh_pt)
+  {
+    // Map from the position of the vertices in the current mesh to the
+    // vertex nodes, and from the vertex nodes to the elements that share
+    // them. The vertices are copied across by Triangle so they can be
+    // matched exactly.
+    std::map<std::pair<double, double>, Node*> old_vertex_pt;
+    std::map<Node*, Vector<FiniteElement*>> old_vertex_element_pt;
+    const unsigned n_old_element = this->nelement();
+    for (unsigned e = 0; e < n_old_element; e++)
+    {
+      FiniteElement* el_pt = this->finite_element_pt(e);
+
+      // The vertices are enumerated first
+      for (unsigned j = 0; j < 3; j++)
+      {
+        Node* nod_pt = el_pt->node_pt(j);
+        old_vertex_pt[std::make_pair(nod_pt->x(0), nod_pt->x(1))] = nod_pt;
+        old_vertex_element_pt[nod_pt].push_back(el_pt);
+      }
+    }
+
+    // Keep track of the nodes that have already been added to the
+    // cavity mesh
+    std::set<Node*> cavity_node_pt;
+
+    // Loop over the elements in the new mesh
+    const unsigned n_new_element = new_mesh_pt->nelement();
+    for (unsigned e = 0; e < n_new_element; e++)
+    {
+      FiniteElement* new_el_pt = new_mesh_pt->finite_element_pt(e);
+      const unsigned n_node = new_el_pt->nnode();
+
+      // Find the vertices of the current mesh that coincide with the
+      // vertices of the new element (if any)
+      Vector<Node*> old_vertex_node_pt(3, 0);
+      bool all_vertices_found = true;
+      for (unsigned j = 0; j < 3; j++)
+      {
+        Node* nod_pt = new_el_pt->node_pt(j);
+        std::map<std::pair<double, double>, Node*>::iterator it =
+          old_vertex_pt.find(std::make_pair(nod_pt->x(0), nod_pt->x(1)));
+        if (it == old_vertex_pt.end())
+        {
+          all_vertices_found = false;
+          break;
+        }
+        old_vertex_node_pt[j] = it->second;
+      }
+
+      // Find the element in the current mesh that has the same vertices
+      FiniteElement* old_el_pt = 0;
+      if (all_vertices_found)
+      {
+        Vector<FiniteElement*>& candidate_el_pt =
+          old_vertex_element_pt[old_vertex_node_pt[0]];
+        const unsigned n_candidate = candidate_el_pt.size();
+        for (unsigned c = 0; c < n_candidate; c++)
+        {
+          // Does the candidate element share the other two vertices?
+          unsigned n_shared = 0;
+          for (unsigned j = 1; j < 3; j++)
+          {
+            for (unsigned k = 0; k < 3; k++)
+            {
+              if (candidate_el_pt[c]->node_pt(k) == old_vertex_node_pt[j])
+              {
+                n_shared++;
+              }
+            }
+          }
+          if (n_shared == 2)
+          {
+            old_el_pt = candidate_el_pt[c];
+            break;
+          }
+        }
+      }
+
+      // Now match up all the nodes (the non-vertex nodes are only
+      // matched to within a small tolerance) and check that the data
+      // in the two elements are compatible
+      bool untouched = ((old_el_pt != 0) && (old_el_pt->nnode() == n_node));
+      bool same_local_node_numbering = true;
+      Vector<Node*> matching_old_node_pt(n_node, 0);
+      if (untouched)
+      {
+        const double tol = 1.0e-10 * sqrt(old_el_pt->size());
+        for (unsigned j = 0; j < n_node; j++)
+        {
+          Node* new_nod_pt = new_el_pt->node_pt(j);
+          for (unsigned k = 0; k < n_node; k++)
+          {
+            Node* old_nod_pt = old_el_pt->node_pt(k);
+            const double dx = new_nod_pt->x(0) - old_nod_pt->x(0);
+            const double dy = new_nod_pt->x(1) - old_nod_pt->x(1);
+            if (sqrt(dx * dx + dy * dy) < tol)
+            {
+              matching_old_node_pt[j] = old_nod_pt;
+              if (k != j)
+              {
+                same_local_node_numbering = false;
+              }
+              break;
+            }
+          }
+
+          // Nodes in the current mesh may store additional values (e.g.
+          // for Lagrange multipliers added by face elements) but not fewer
+          if ((matching_old_node_pt[j] == 0) ||
+              (matching_old_node_pt[j]->nvalue() < new_nod_pt->nvalue()))
+          {
+            untouched = false;
+            break;
+          }
+        }
+      }
+
+      // Internal data (e.g. discontinuous pressures) can only be copied
+      // if the local node numbering is the same in both elements
+      if (untouched)
+      {
+        const unsigned n_internal = new_el_pt->ninternal_data();
+        if (n_internal > 0)
+        {
+          if ((!same_local_node_numbering) ||
+              (old_el_pt->ninternal_data() != n_internal))
+          {
+            untouched = false;
+          }
+          else
+          {
+            for (unsigned i = 0; i < n_internal; i++)
+            {
+              if (old_el_pt->internal_data_pt(i)->nvalue() !=
+                  new_el_pt->internal_data_pt(i)->nvalue())
+              {
+                untouched = false;
+                break;
+              }
+            }
+          }
+        }
+      }
+
+      if (untouched)
+      {
+        untouched_element_pt.push_back(std::make_pair(new_el_pt, old_el_pt));
+        for (unsigned j = 0; j < n_node; j++)
+        {
+          old_node_pt[new_el_pt->node_pt(j)] = matching_old_node_pt[j];
+        }
+      }
+      // The element is in a re-meshed cavity
+      else
+      {
+        cavity_mesh_pt->add_element_pt(new_el_pt);
+        for (unsigned j = 0; j < n_node; j++)
+        {
+          Node* nod_pt = new_el_pt->node_pt(j);
+          if (cavity_node_pt.insert(nod_pt).second)
+          {
+            cavity_mesh_pt->add_node_pt(nod_pt);
+          }
+        }
+      }
+    } // for (e<n_new_element)
+  }
+
+  //======================================================================
+  /// Helper function for local adaptation: Copy the nodal values and
+  /// positions and the internal data (incl. their history values) from
+  /// the current mesh to the untouched elements in the new mesh
+  //======================================================================
+  template<class ELEMENT>
+  void RefineableTriangleMesh<ELEMENT>::copy_data_to_untouched_elements(
+    const Vector<std::pair<FiniteElement*, FiniteElement*>>&
+      untouched_element_pt,
+    const std::map<Node*, Node*>& old_node_pt)
+  {
+    // Copy the nodal values and positions
+    for (std::map<Node*, Node*>::const_iterator it = old_node_pt.begin();
+         it != old_node_pt.end();
+         it++)
+    {
+      Node* new_nod_pt = it->first;
+      Node* old_nod_pt = it->second;
+
+      const unsigned n_time = new_nod_pt->ntstorage();
+      const unsigned n_value = new_nod_pt->nvalue();
+      for (unsigned t = 0; t < n_time; t++)
+      {
+        for (unsigned i = 0; i < n_value; i++)
+        {
+          new_nod_pt->set_value(t, i, old_nod_pt->value(t, i));
+        }
+      }
+
+      const unsigned n_position_time =
+        new_nod_pt->position_time_stepper_pt()->ntstorage();
+      const unsigned n_dim = new_nod_pt->ndim();
+      for (unsigned t = 0; t < n_position_time; t++)
+      {
+        for (unsigned i = 0; i < n_dim; i++)
+        {
+          new_nod_pt->x(t, i) = old_nod_pt->x(t, i);
+        }
+      }
+    }
+
+    // Copy the internal data
+    const unsigned n_untouched = untouched_element_pt.size();
+    for (unsigned e = 0; e < n_untouched; e++)
+    {
+      FiniteElement* new_el_pt = untouched_element_pt[e].first;
+      FiniteElement* old_el_pt = untouched_element_pt[e].second;
+      const unsigned n_internal = new_el_pt->ninternal_data();
+      for (unsigned i = 0; i < n_internal; i++)
+      {
+        Data* new_data_pt = new_el_pt->internal_data_pt(i);
+        Data* old_data_pt = old_el_pt->internal_data_pt(i);
+        const unsigned n_time = new_data_pt->ntstorage();
+        const unsigned n_value = new_data_pt->nvalue();
+        for (unsigned t = 0; t < n_time; t++)
+        {
+          for (unsigned k = 0; k < n_value; k++)
+          {
+            new_data_pt->set_value(t, k, old_data_pt->value(t, k));
+          }
+        }
+      }
+    }
+  }
+
   //======================================================================
   /// Adapt problem based on specified elemental error estimates
   /// This function implement serial and parallel mesh adaptation, the
@@ -30169,6 +30417,37 @@ namespace oomph
       // Are we dealing with a solid mesh?
       SolidMesh* solid_mesh_pt = dynamic_cast<SolidMesh*>(this);
 
+      // Can we get away with re-meshing locally? If the adaptation
+      // only requires refinement we refine the current triangulation
+      // rather than building a new mesh from a uniform background mesh,
+      // so Triangle only re-meshes the cavities around the elements that
+      // are flagged for refinement. This is not possible if elements
+      // need to be unrefined, the boundary representation needs updating
+      // or the min. angle criterion triggered the re-meshing.
+      bool local_adaptation = false;
+      if (Use_local_adaptation && (Nunrefined <= max_keep_unrefined()) &&
+          (min_angle >= min_permitted_angle()) &&
+          (!outer_boundary_update_necessary) &&
+          (!inner_boundary_update_necessary) &&
+          (!inner_open_boundary_update_necessary) &&
+          (this->is_automatic_creation_of_vertices_on_boundaries_allowed()) &&
+          (this->triangulateio_exists()) && (solid_mesh_pt == 0))
+      {
+        local_adaptation = true;
+#ifdef OOMPH_HAS_MPI
+        if (this->is_mesh_distributed())
+        {
+          local_adaptation = false;
+        }
+#endif
+      }
+
+      if (local_adaptation)
+      {
+        oomph_info << "Local adaptation: Only re-meshing the cavities "
+                   << "around the elements to be refined.\n";
+      }
+
       // Build temporary uniform background mesh
       //----------------------------------------
       // with area set by maximum required area
@@ -30287,146 +30566,162 @@ namespace oomph
       }
 #endif
 
-      // ----------------------------------------------------------
-      // Build the background mesh using Triangle
-      // ----------------------------------------------------------
-      const double t_start_building_background_mesh = TimingHelpers::timer();
+      // Timings for the background mesh
+      double t_total_second_stage_segments_connectivity = 0.0;
+      double t_total_snap_nodes_bg_mesh = 0.0;
 
-      if (solid_mesh_pt != 0)
+      if (local_adaptation)
       {
-        tmp_new_mesh_pt = new RefineableSolidTriangleMesh<ELEMENT>(
-          triangle_mesh_parameters, this->Time_stepper_pt);
+        // The current mesh itself acts as the background mesh; make
+        // sure its TriangulateIO representation is up to date with
+        // the current nodal positions
+        this->update_triangulateio();
+        tmp_new_mesh_pt = this;
       }
       else
       {
-        tmp_new_mesh_pt = new RefineableTriangleMesh<ELEMENT>(
-          triangle_mesh_parameters, this->Time_stepper_pt);
-      }
+        // ----------------------------------------------------------
+        // Build the background mesh using Triangle
+        // ----------------------------------------------------------
+        const double t_start_building_background_mesh = TimingHelpers::timer();
 
-      if (Print_timings_level_adaptation > 2)
-      {
-        oomph_info << "CPU for building background mesh: "
-                   << TimingHelpers::timer() - t_start_building_background_mesh
-                   << std::endl;
-      }
+        if (solid_mesh_pt != 0)
+        {
+          tmp_new_mesh_pt = new RefineableSolidTriangleMesh<ELEMENT>(
+            triangle_mesh_parameters, this->Time_stepper_pt);
+        }
+        else
+        {
+          tmp_new_mesh_pt = new RefineableTriangleMesh<ELEMENT>(
+            triangle_mesh_parameters, this->Time_stepper_pt);
+        }
 
-      // Pass the info. regarding the maximum and minimum element size
-      // from the old mesh to the background mesh
-      const double this_max_element_size = this->max_element_size();
-      const double this_min_element_size = this->min_element_size();
-      tmp_new_mesh_pt->max_element_size() = this_max_element_size;
-      tmp_new_mesh_pt->min_element_size() = this_min_element_size;
+        if (Print_timings_level_adaptation > 2)
+        {
+          oomph_info
+            << "CPU for building background mesh: "
+            << TimingHelpers::timer() - t_start_building_background_mesh
+            << std::endl;
+        }
 
-      // ... also copy the minimum permitted angle
-      const double this_min_permitted_angle = this->min_permitted_angle();
-      tmp_new_mesh_pt->min_permitted_angle() = this_min_permitted_angle;
+        // Pass the info. regarding the maximum and minimum element size
+        // from the old mesh to the background mesh
+        const double this_max_element_size = this->max_element_size();
+        const double this_min_element_size = this->min_element_size();
+        tmp_new_mesh_pt->max_element_size() = this_max_element_size;
+        tmp_new_mesh_pt->min_element_size() = this_min_element_size;
 
-      // ------------------------------------------
-      // DISTRIBUTED MESH: BEGIN
-      // ------------------------------------------
+        // ... also copy the minimum permitted angle
+        const double this_min_permitted_angle = this->min_permitted_angle();
+        tmp_new_mesh_pt->min_permitted_angle() = this_min_permitted_angle;
+
+        // ------------------------------------------
+        // DISTRIBUTED MESH: BEGIN
+        // ------------------------------------------
 #ifdef OOMPH_HAS_MPI
-      // If the mesh is distributed we need to pass and set the
-      // information of internal boundaries overlaped by shared
-      // boundaries
-      if (this->is_mesh_distributed())
-      {
-        // Check if necessary to fill boundary elements for those
-        // internal boundaries that overlap shared boundaries
-        if (this->nshared_boundary_overlaps_internal_boundary() > 0)
+        // If the mesh is distributed we need to pass and set the
+        // information of internal boundaries overlaped by shared
+        // boundaries
+        if (this->is_mesh_distributed())
         {
-          // Copy the data structures that indicates which shared
-          // boundaries are part of an internal boundary
-          tmp_new_mesh_pt->shared_boundary_overlaps_internal_boundary() =
-            this->shared_boundary_overlaps_internal_boundary();
+          // Check if necessary to fill boundary elements for those
+          // internal boundaries that overlap shared boundaries
+          if (this->nshared_boundary_overlaps_internal_boundary() > 0)
+          {
+            // Copy the data structures that indicates which shared
+            // boundaries are part of an internal boundary
+            tmp_new_mesh_pt->shared_boundary_overlaps_internal_boundary() =
+              this->shared_boundary_overlaps_internal_boundary();
 
-          // Copy the data structure that indicates which are the shared
-          // boundaries in each processor
-          tmp_new_mesh_pt->shared_boundaries_ids() =
-            this->shared_boundaries_ids();
+            // Copy the data structure that indicates which are the shared
+            // boundaries in each processor
+            tmp_new_mesh_pt->shared_boundaries_ids() =
+              this->shared_boundaries_ids();
 
-          // Fill the structures for the boundary elements and face indexes
-          // of the boundary elements
-          tmp_new_mesh_pt
-            ->fill_boundary_elements_and_nodes_for_internal_boundaries();
+            // Fill the structures for the boundary elements and face indexes
+            // of the boundary elements
+            tmp_new_mesh_pt
+              ->fill_boundary_elements_and_nodes_for_internal_boundaries();
 
-        } // if (this->nshared_boundary_overlaps_internal_boundary() > 0)
+          } // if (this->nshared_boundary_overlaps_internal_boundary() > 0)
 
-      } // if (this->is_mesh_distributed())
+        } // if (this->is_mesh_distributed())
 #endif // #ifdef OOMPH_HAS_MPI
-      // ------------------------------------------
-      // DISTRIBUTED MESH: END
-      // ------------------------------------------
+        // ------------------------------------------
+        // DISTRIBUTED MESH: END
+        // ------------------------------------------
 
-      // Snap to curvilinear boundaries (some code duplication as this
-      // is repeated below but helper function would take so many
-      // arguments that it's nearly as messy...
+        // Snap to curvilinear boundaries (some code duplication as this
+        // is repeated below but helper function would take so many
+        // arguments that it's nearly as messy...
 
-      // Pass the boundary geometric objects to the new mesh
-      tmp_new_mesh_pt->boundary_geom_object_pt() =
-        this->boundary_geom_object_pt();
+        // Pass the boundary geometric objects to the new mesh
+        tmp_new_mesh_pt->boundary_geom_object_pt() =
+          this->boundary_geom_object_pt();
 
-      // Reset the boundary coordinates if there is
-      // a geometric object associated with the boundary
-      tmp_new_mesh_pt->boundary_coordinate_limits() =
-        this->boundary_coordinate_limits();
+        // Reset the boundary coordinates if there is
+        // a geometric object associated with the boundary
+        tmp_new_mesh_pt->boundary_coordinate_limits() =
+          this->boundary_coordinate_limits();
 
-      const double t_start_second_stage_segments_connectivity =
-        TimingHelpers::timer();
+        const double t_start_second_stage_segments_connectivity =
+          TimingHelpers::timer();
 
-      for (unsigned b = 0; b < n_boundary; b++)
-      {
-        // ------------------------------------------
-        // DISTRIBUTED MESH: BEGIN
-        // ------------------------------------------
-#ifdef OOMPH_HAS_MPI
-        if (this->is_mesh_distributed())
+        for (unsigned b = 0; b < n_boundary; b++)
         {
-          // Identify the segments of the new mesh with the ones of the
-          // original mesh
-          tmp_new_mesh_pt
-            ->identify_boundary_segments_and_assign_initial_zeta_values(b,
-                                                                        this);
-        }
+          // ------------------------------------------
+          // DISTRIBUTED MESH: BEGIN
+          // ------------------------------------------
+#ifdef OOMPH_HAS_MPI
+          if (this->is_mesh_distributed())
+          {
+            // Identify the segments of the new mesh with the ones of the
+            // original mesh
+            tmp_new_mesh_pt
+              ->identify_boundary_segments_and_assign_initial_zeta_values(b,
+                                                                          this);
+          }
 #endif
-        // ------------------------------------------
-        // DISTRIBUTED MESH: END
-        // ------------------------------------------
+          // ------------------------------------------
+          // DISTRIBUTED MESH: END
+          // ------------------------------------------
 
-        // Setup boundary coordinates for boundaries with GeomObject
-        // associated
-        if (tmp_new_mesh_pt->boundary_geom_object_pt(b) != 0)
-        {
-          tmp_new_mesh_pt->template setup_boundary_coordinates<ELEMENT>(b);
+          // Setup boundary coordinates for boundaries with GeomObject
+          // associated
+          if (tmp_new_mesh_pt->boundary_geom_object_pt(b) != 0)
+          {
+            tmp_new_mesh_pt->template setup_boundary_coordinates<ELEMENT>(b);
+          }
         }
-      }
 
-      const double t_total_second_stage_segments_connectivity =
-        TimingHelpers::timer() - t_start_second_stage_segments_connectivity;
+        t_total_second_stage_segments_connectivity =
+          TimingHelpers::timer() - t_start_second_stage_segments_connectivity;
 
-      const double t_start_snap_nodes_bg_mesh = TimingHelpers::timer();
-      // Move the nodes on the new boundary onto the old curvilinear
-      // boundary. If the boundary is straight this will do precisely
-      // nothing but will be somewhat inefficient
-      for (unsigned b = 0; b < n_boundary; b++)
-      {
-        this->snap_nodes_onto_boundary(tmp_new_mesh_pt, b);
-      }
+        const double t_start_snap_nodes_bg_mesh = TimingHelpers::timer();
+        // Move the nodes on the new boundary onto the old curvilinear
+        // boundary. If the boundary is straight this will do precisely
+        // nothing but will be somewhat inefficient
+        for (unsigned b = 0; b < n_boundary; b++)
+        {
+          this->snap_nodes_onto_boundary(tmp_new_mesh_pt, b);
+        }
 
-      const double t_total_snap_nodes_bg_mesh =
-        TimingHelpers::timer() - t_start_snap_nodes_bg_mesh;
+        t_total_snap_nodes_bg_mesh =
+          TimingHelpers::timer() - t_start_snap_nodes_bg_mesh;
 
-      if (Print_timings_level_adaptation > 2)
-      {
-        oomph_info << "CPU for snapping nodes onto boundaries "
-                   << "(background mesh): " << t_total_snap_nodes_bg_mesh
-                   << std::endl;
-      }
+        if (Print_timings_level_adaptation > 2)
+        {
+          oomph_info << "CPU for snapping nodes onto boundaries "
+                     << "(background mesh): " << t_total_snap_nodes_bg_mesh
+                     << std::endl;
+        }
 
-      // Update mesh further?
-      if (Mesh_update_fct_pt != 0)
-      {
-        Mesh_update_fct_pt(tmp_new_mesh_pt);
-      }
+        // Update mesh further?
+        if (Mesh_update_fct_pt != 0)
+        {
+          Mesh_update_fct_pt(tmp_new_mesh_pt);
+        }
+      } // else if (local_adaptation)
 
       // If we have a continuation problem
       // any problem in which the timestepper is a "generalisedtimestepper",
@@ -30698,6 +30993,15 @@ namespace oomph
         Vector<double> new_transferred_target_area(nelem, 0.0);
         for (unsigned e = 0; e < nelem; e++)
         { // start loop el
+          // If the "temporary" mesh is the current mesh itself (first
+          // stage of local adaptation) the target areas don't have to be
+          // located
+          if (tmp_new_mesh_pt == this)
+          {
+            new_transferred_target_area[e] = target_area[e];
+            continue;
+          }
+
           ELEMENT* el_pt =
             dynamic_cast<ELEMENT*>(tmp_new_mesh_pt->element_pt(e));
           unsigned nint = el_pt->integral_pt()->nweight();
@@ -31184,7 +31488,13 @@ namespace oomph
 
         // Not done: get ready for another iteration
         iter++;
-        delete tmp_new_mesh_pt;
+
+        // Delete the temporary mesh (unless it's the current mesh, used
+        // as the starting point for local adaptation)
+        if (tmp_new_mesh_pt != this)
+        {
+          delete tmp_new_mesh_pt;
+        }
 
 #ifdef OOMPH_HAS_MPI
         // Check whether the number of elements that need (un)refinement
@@ -31203,11 +31513,17 @@ namespace oomph
         // DISTRIBUTED MESH: BEGIN
         // ------------------------------------------
 
-        // We can only finish the iteration adaptation process if ALL
-        // the involved processor are marked as done, otherwise, ALL
-        // processor need to go for another iteration
+        // The iterations don't involve any communication: the shared
+        // boundaries are fixed, so each processor refines its own
+        // sub-domain until it's done. Only synchronise the processors
+        // if requested (e.g. because the mesh update function involves
+        // collective communication); in that case we can only finish the
+        // iteration adaptation process if ALL the involved processor are
+        // marked as done, otherwise, ALL processor need to go for another
+        // iteration
 #ifdef OOMPH_HAS_MPI
-        if (this->is_mesh_distributed())
+        if (this->is_mesh_distributed() &&
+            Synchronise_iterations_for_distributed_adaptation)
         {
           // Time to check whether other processors have finish to adapt
           const double t_start_wait_other_processors = TimingHelpers::timer();
@@ -31283,8 +31599,61 @@ namespace oomph
       // current mesh
       delete mesh_geom_obj_pt;
 
+      const double t_total_iter = TimingHelpers::timer() - t_iter;
       oomph_info << "CPU for iterative generation of new mesh (TOTAL): "
-                 << TimingHelpers::timer() - t_iter << std::endl;
+                 << t_total_iter << std::endl;
+
+      // ------------------------------------------
+      // DISTRIBUTED MESH: BEGIN
+      // ------------------------------------------
+#ifdef OOMPH_HAS_MPI
+      // Report the load imbalance of the (independent) generation of
+      // the new meshes on each processor
+      if (this->is_mesh_distributed() && Print_timings_level_adaptation > 1)
+      {
+        double t_this_iter = t_total_iter;
+        double t_global_min_iter = 0.0;
+        double t_global_max_iter = 0.0;
+        unsigned n_this_iter = iter;
+        unsigned n_global_max_iter = 0;
+
+        // Get the minimum and maximum time and the maximum number of
+        // iterations
+        MPI_Reduce(&t_this_iter,
+                   &t_global_min_iter,
+                   1,
+                   MPI_DOUBLE,
+                   MPI_MIN,
+                   0,
+                   this->communicator_pt()->mpi_comm());
+        MPI_Reduce(&t_this_iter,
+                   &t_global_max_iter,
+                   1,
+                   MPI_DOUBLE,
+                   MPI_MAX,
+                   0,
+                   this->communicator_pt()->mpi_comm());
+        MPI_Reduce(&n_this_iter,
+                   &n_global_max_iter,
+                   1,
+                   MPI_UNSIGNED,
+                   MPI_MAX,
+                   0,
+                   this->communicator_pt()->mpi_comm());
+
+        if (this->communicator_pt()->my_rank() == 0)
+        {
+          oomph_info << "CPU for iterative generation of new mesh global "
+                     << "(MIN): " << t_global_min_iter << std::endl;
+          oomph_info << "CPU for iterative generation of new mesh global "
+                     << "(MAX) [n_max_iter_global=" << n_global_max_iter
+                     << "]: " << t_global_max_iter << std::endl;
+        }
+      }
+#endif // #ifdef OOMPH_HAS_MPI
+      // ------------------------------------------
+      // DISTRIBUTED MESH: END
+      // ------------------------------------------
 
       if (Print_timings_level_adaptation > 1)
       {
@@ -31377,8 +31746,35 @@ namespace oomph
         else
 #endif // #ifdef OOMPH_HAS_MPI
         {
+          // The elements in the new mesh that were not touched by a
+          // local adaptation (paired with their counterparts in the
+          // current mesh) and the map from their nodes to the
+          // corresponding nodes in the current mesh
+          Vector<std::pair<FiniteElement*, FiniteElement*>>
+            untouched_element_pt;
+          std::map<Node*, Node*> old_node_pt;
+
+          // Mesh containing the elements in the re-meshed cavities (only
+          // used for local adaptation)
+          Mesh* cavity_mesh_pt = 0;
+
           // Set the mesh used for the projection object
-          project_problem_pt->mesh_pt() = new_mesh_pt;
+          if (local_adaptation)
+          {
+            // Only project onto the elements in the re-meshed cavities
+            cavity_mesh_pt = new Mesh;
+            identify_untouched_elements(
+              new_mesh_pt, untouched_element_pt, old_node_pt, cavity_mesh_pt);
+            project_problem_pt->mesh_pt() = cavity_mesh_pt;
+
+            oomph_info << "Local adaptation: Projecting onto "
+                       << cavity_mesh_pt->nelement() << " of "
+                       << new_mesh_pt->nelement() << " elements.\n";
+          }
+          else
+          {
+            project_problem_pt->mesh_pt() = new_mesh_pt;
+          }
 
           // project_problem_pt->disable_suppress_output_during_projection();
 
@@ -31389,8 +31785,26 @@ namespace oomph
             project_problem_pt->disable_use_iterative_solver_for_projection();
           }
 
-          // Do the projection
-          project_problem_pt->project(this);
+          // Do the projection (unless all elements were untouched)
+          if (project_problem_pt->mesh_pt()->nelement() > 0)
+          {
+            project_problem_pt->project(this);
+          }
+
+          if (local_adaptation)
+          {
+            // Copy the data across from the untouched elements. This
+            // also overwrites the projected values at the nodes on the
+            // boundaries of the cavities, so the solution remains
+            // continuous
+            copy_data_to_untouched_elements(untouched_element_pt,
+                                            old_node_pt);
+
+            // Flush the cavity mesh before deleting it -- its elements
+            // and nodes belong to the new mesh
+            cavity_mesh_pt->flush_element_and_node_storage();
+            delete cavity_mesh_pt;
+          }
         }
 
         // Reset printing info. for projection
@@ -2442,6 +2442,27 @@ namespace oomph
       Disable_projection = true;
     }
 
+    /// \short Enables local adaptation: If the adaptation only requires
+    /// refinement (no unrefinement, no update of the boundary
+    /// representation and no re-meshing triggered by the min. angle
+    /// criterion) the current triangulation is refined in place, so only
+    /// the cavities around the elements that are flagged for refinement
+    /// are re-meshed. The solution is then only projected onto the
+    /// elements in the cavities; the values in the untouched elements
+    /// are copied across directly. Not available for solid or
+    /// distributed meshes.
+    void enable_local_adaptation()
+    {
+      Use_local_adaptation = true;
+    }
+
+    /// \short Disables local adaptation (the mesh is always fully
+    /// re-generated during adaptation)
+    void disable_local_adaptation()
+    {
+      Use_local_adaptation = false;
+    }
+
     /// \short Enables info. and timings for projection
     void enable_timings_projection()
     {
@@ -2572,6 +2593,26 @@ namespace oomph
       }
     }
 
+    /// \short Enables the synchronisation of all processors after each
+    /// iteration of the (per-processor) generation of the new mesh during
+    /// the adaptation of a distributed mesh. This is only required if the
+    /// function pointed to by Mesh_update_fct_pt involves collective
+    /// communication.
+    void enable_synchronised_iterations_for_distributed_adaptation()
+    {
+      Synchronise_iterations_for_distributed_adaptation = true;
+    }
+
+    /// \short Disables the synchronisation of all processors after each
+    /// iteration of the (per-processor) generation of the new mesh during
+    /// the adaptation of a distributed mesh (default). Each processor
+    /// keeps refining its own sub-domain (whose shared boundaries are
+    /// fixed during the iterations) until it's done.
+    void disable_synchronised_iterations_for_distributed_adaptation()
+    {
+      Synchronise_iterations_for_distributed_adaptation = false;
+    }
+
     /// Doc the targets for mesh adaptation
     void doc_adaptivity_targets(std::ostream& outfile)
     {
@@ -3663,6 +3704,9 @@ namespace oomph
       // By default we want to do projection
       this->Disable_projection = false;
 
+      // By default the mesh is fully re-generated during adaptation
+      this->Use_local_adaptation = false;
+
       // Use by default an iterative solver for the projection problem
       this->Use_iterative_solver_for_projection = true;
 
@@ -3672,6 +3716,10 @@ namespace oomph
       // Set the defaul value for printing level load balance (default 0)
       this->Print_timings_level_load_balance = 0;
 
+      // By default each processor iterates independently when
+      // generating the new (distributed) mesh
+      this->Synchronise_iterations_for_distributed_adaptation = false;
+
       // By default we want no info. about timings for transferring of
       // target areas
       this->Print_timings_transfering_target_areas = false;
@@ -3700,6 +3748,27 @@ namespace oomph
 
 #endif // #ifdef OOMPH_HAS_TRIANGLE_LIB
 
+    /// \short Helper function for local adaptation: Identify the
+    /// elements in the new mesh that coincide with elements in the
+    /// current mesh (i.e. the ones that were not touched by the local
+    /// re-meshing) and return them, paired with their counterparts in
+    /// the current mesh, along with the map from their nodes to the
+    /// corresponding nodes in the current mesh. All other elements of the
+    /// new mesh (and their nodes) are added to the cavity mesh.
+    void identify_untouched_elements(
+      Mesh* new_mesh_pt,
+      Vector<std::pair<FiniteElement*, FiniteElement*>>& untouched_element_pt,
+      std::map<Node*, Node*>& old_node_pt,
+      Mesh* cavity_mesh_pt);
+
+    /// \short Helper function for local adaptation: Copy the nodal values
+    /// and positions and the internal data (incl. their history values)
+    /// from the current mesh to the untouched elements in the new mesh
+    void copy_data_to_untouched_elements(
+      const Vector<std::pair<FiniteElement*, FiniteElement*>>&
+        untouched_element_pt,
+      const std::map<Node*, Node*>& old_node_pt);
+
     /// \short Compute target area based on the element's error and the
     /// error target; return minimum angle (in degrees)
     double compute_area_target(const Vector<double>& elem_error,
@@ -3859,6 +3928,11 @@ namespace oomph
     /// Enable/disable solution projection during adaptation
     bool Disable_projection;
 
+    /// \short Re-mesh only the cavities around the elements that are
+    /// flagged for refinement (if possible) rather than re-generating
+    /// the whole mesh during adaptation
+    bool Use_local_adaptation;
+
     /// Flag to indicate whether to use or not an iterative solver (CG
     /// with diagonal preconditioned) for the projection problem
     bool Use_iterative_solver_for_projection;
@@ -3875,6 +3949,11 @@ namespace oomph
     /// The printing level for load balance
     unsigned Print_timings_level_load_balance;
 
+    /// \short Synchronise all processors after each iteration of the
+    /// generation of the new mesh during the adaptation of a distributed
+    /// mesh?
+    bool Synchronise_iterations_for_distributed_adaptation;
+
     /// \short Function pointer to function that updates the
     /// mesh following the snapping of boundary nodes to the
     /// boundaries (e.g. to move boundary nodes very slightly
@@ -86,6 +86,12 @@ namespace oomph
 
       // set Doc_time to false
       Doc_time = false;
+
+      // By default, set up the solid preconditioner from scratch every time
+      Reuse_solid_preconditioner = false;
+      Solid_preconditioner_reuse_tolerance = 0.1;
+      Max_nsolid_preconditioner_reuse = 10;
+      Nsolid_preconditioner_reuse = 0;
     }
 
 
@@ -131,6 +137,9 @@ namespace oomph
         delete Solid_preconditioner_pt;
       }
       Solid_preconditioner_pt = solid_preconditioner_pt;
+
+      // The new preconditioner has to be set up from scratch
+      Solid_block_at_last_solid_preconditioner_setup.clear();
     }
 
     /// Read-only access to solid preconditoner (use set_... to set it)
@@ -218,6 +227,35 @@ namespace oomph
       Doc_time = false;
     }
 
+    /// \short Re-use the solid preconditioner (i.e. don't set it up again)
+    /// for as long as the relative change (in the Frobenius norm) of the
+    /// solid block since the last time it was set up is less than tol,
+    /// but for at most max_nreuse consecutive setups. Only the fluid
+    /// (Navier-Stokes Schur complement) preconditioner and the coupling
+    /// matrix-vector products are then re-computed.
+    void enable_solid_preconditioner_reuse(const double& tol = 0.1,
+                                           const unsigned& max_nreuse = 10)
+    {
+      Reuse_solid_preconditioner = true;
+      Solid_preconditioner_reuse_tolerance = tol;
+      Max_nsolid_preconditioner_reuse = max_nreuse;
+    }
+
+    /// \short Set up the solid preconditioner from scratch every time
+    /// (default)
+    void disable_solid_preconditioner_reuse()
+    {
+      Reuse_solid_preconditioner = false;
+      Solid_block_at_last_solid_preconditioner_setup.clear();
+    }
+
+    /// \short Number of consecutive setups for which the solid preconditioner
+    /// has been re-used
+    unsigned nsolid_preconditioner_reuse() const
+    {
+      return Nsolid_preconditioner_reuse;
+    }
+
 
   private:
     /// Pointer the Navier Stokes preconditioner (inexact solver)
@@ -246,6 +284,26 @@ namespace oomph
     /// Set Doc_time to true for outputting results of timings
     bool Doc_time;
 
+    /// \short Boolean flag to indicate that the solid preconditioner may be
+    /// re-used if the solid block hasn't changed much
+    bool Reuse_solid_preconditioner;
+
+    /// \short Max. relative change (in the Frobenius norm) of the solid block
+    /// for which the solid preconditioner is re-used
+    double Solid_preconditioner_reuse_tolerance;
+
+    /// \short Max. number of consecutive setups for which the solid
+    /// preconditioner is re-used
+    unsigned Max_nsolid_preconditioner_reuse;
+
+    /// \short Number of consecutive setups for which the solid preconditioner
+    /// has been re-used
+    unsigned Nsolid_preconditioner_reuse;
+
+    /// \short Copy of the solid block for which the solid preconditioner
+    /// was last set up
+    CRDoubleMatrix Solid_block_at_last_solid_preconditioner_setup;
+
     /// Pointer to the navier stokes mesh
     Mesh* Navier_stokes_mesh_pt;
 
@@ -309,7 +367,9 @@ namespace oomph
     }
 
     // Call block setup for this preconditioner
+    double t_block_setup_start = TimingHelpers::timer();
     this->block_setup(dof_to_block_map);
+    double t_block_setup_end = TimingHelpers::timer();
 
     // Block mapping for the subsidiary Navier Stokes preconditioner:
     // blocks 0 and 1 in the FSI preconditioner are also blocks 0 and 1
@@ -329,7 +389,9 @@ namespace oomph
     // Navier Stokes mesh and set it up.
     Navier_stokes_preconditioner_pt->set_navier_stokes_mesh(
       Navier_stokes_mesh_pt);
+    double t_fluid_start = TimingHelpers::timer();
     Navier_stokes_preconditioner_pt->setup(matrix_pt());
+    double t_fluid_end = TimingHelpers::timer();
 
     // Extract the additional blocks we need for FSI:
 
@@ -337,9 +399,36 @@ namespace oomph
     CRDoubleMatrix block_matrix_1_1;
     this->get_block(1, 1, block_matrix_1_1);
 
+    // Can we re-use the solid preconditioner?
+    bool reuse_solid_preconditioner = false;
+    double solid_block_change = DBL_MAX;
+    if (Reuse_solid_preconditioner && Preconditioner_has_been_setup &&
+        (Nsolid_preconditioner_reuse < Max_nsolid_preconditioner_reuse))
+    {
+      solid_block_change = CRDoubleMatrixHelpers::relative_frobenius_change(
+        block_matrix_1_1, Solid_block_at_last_solid_preconditioner_setup);
+      reuse_solid_preconditioner =
+        (solid_block_change < Solid_preconditioner_reuse_tolerance);
+    }
+
     // Setup the solid preconditioner (inexact solver)
     double t_start = TimingHelpers::timer();
-    Solid_preconditioner_pt->setup(&block_matrix_1_1);
+    if (reuse_solid_preconditioner)
+    {
+      Nsolid_preconditioner_reuse++;
+    }
+    else
+    {
+      Solid_preconditioner_pt->setup(&block_matrix_1_1);
+      Nsolid_preconditioner_reuse = 0;
+
+      // Keep a copy of the block to assess the change next time
+      if (Reuse_solid_preconditioner)
+      {
+        CRDoubleMatrixHelpers::deep_copy(
+          &block_matrix_1_1, Solid_block_at_last_solid_preconditioner_setup);
+      }
+    }
     double t_end = TimingHelpers::timer();
     block_matrix_1_1.clear();
     double setup_time = t_end - t_start;
@@ -359,12 +448,24 @@ namespace oomph
       this->setup_matrix_vector_product(
         Matrix_vector_product_1_0_pt, &block_matrix_1_0, 0);
     }
+    double t_matvec_end = TimingHelpers::timer();
 
     // Output times
     if (Doc_time)
     {
-      oomph_info << "Solid sub-preconditioner setup time [sec]: " << setup_time
-                 << "\n";
+      oomph_info << "Block setup time [sec]: "
+                 << t_block_setup_end - t_block_setup_start << "\n";
+      oomph_info << "Fluid sub-preconditioner setup time [sec]: "
+                 << t_fluid_end - t_fluid_start << "\n";
+      oomph_info << "Solid sub-preconditioner setup time [sec]: " << setup_time;
+      if (reuse_solid_preconditioner)
+      {
+        oomph_info << " (re-used; relative change in solid block: "
+                   << solid_block_change << ")";
+      }
+      oomph_info << "\n";
+      oomph_info << "Coupling matrix-vector product setup time [sec]: "
+                 << t_matvec_end - t_end << "\n";
     }
 
     // We're done (and we stored some data)
@@ -51,8 +51,21 @@ namespace oomph
   //=============================================================================
   void PseudoElasticFSIPreconditioner::setup()
   {
-    // clean the memory
-    this->clean_up_memory();
+    // clean the memory (if the solid and pseudo-elastic preconditioners
+    // may be re-used they're only wiped if they're set up again below)
+    if (!Reuse_solid_and_pseudo_elastic_preconditioners)
+    {
+      this->clean_up_memory();
+    }
+    else
+    {
+      Navier_stokes_preconditioner_pt->clean_up_memory();
+      Navier_stokes_schur_complement_preconditioner_pt->clean_up_memory();
+      Fluid_pseudo_elastic_matvec_pt->clean_up_memory();
+      Solid_fluid_matvec_pt->clean_up_memory();
+      Solid_pseudo_elastic_matvec_pt->clean_up_memory();
+      Lagrange_solid_matvec_pt->clean_up_memory();
+    }
 
 #ifdef PARANOID
     // paranoid check that the meshes have been set
@@ -136,7 +149,75 @@ namespace oomph
 #endif
 
     // Call block setup for this preconditioner
+    double t_start = TimingHelpers::timer();
     this->block_setup(dof_to_block_map);
+    double t_block_setup = TimingHelpers::timer();
+
+    // Can the solid and pseudo-elastic preconditioners be re-used?
+    bool reuse_solid_preconditioner = false;
+    bool reuse_pseudo_elastic_preconditioner = false;
+    double solid_block_change = DBL_MAX;
+    double pseudo_elastic_block_change = DBL_MAX;
+    if (Reuse_solid_and_pseudo_elastic_preconditioners)
+    {
+      CRDoubleMatrix solid_block;
+      this->get_block(1, 1, solid_block);
+      CRDoubleMatrix pseudo_elastic_block;
+      this->get_block(2, 2, pseudo_elastic_block);
+      // The pseudo-elastic preconditioner also uses the blocks that couple
+      // the Lagrange multipliers to the pseudo-elastic dofs; these change
+      // with the position of the FSI interface
+      CRDoubleMatrix lagrange_multiplier_block;
+      this->get_block(3, 2, lagrange_multiplier_block);
+      if (Subsidiary_preconditioners_have_been_setup)
+      {
+        if (Nsolid_preconditioner_reuse < Max_nreuse)
+        {
+          solid_block_change = CRDoubleMatrixHelpers::relative_frobenius_change(
+            solid_block, Solid_block_at_last_setup);
+          reuse_solid_preconditioner = (solid_block_change < Reuse_tolerance);
+        }
+        if (Npseudo_elastic_preconditioner_reuse < Max_nreuse)
+        {
+          pseudo_elastic_block_change = std::max(
+            CRDoubleMatrixHelpers::relative_frobenius_change(
+              pseudo_elastic_block, Pseudo_elastic_block_at_last_setup),
+            CRDoubleMatrixHelpers::relative_frobenius_change(
+              lagrange_multiplier_block,
+              Lagrange_multiplier_block_at_last_setup));
+          reuse_pseudo_elastic_preconditioner =
+            (pseudo_elastic_block_change < Reuse_tolerance);
+        }
+      }
+
+      // Keep copies of the blocks for which the preconditioners are
+      // (about to be) set up to assess the change next time
+      if (reuse_solid_preconditioner)
+      {
+        Nsolid_preconditioner_reuse++;
+      }
+      else
+      {
+        Solid_preconditioner_pt->clean_up_memory();
+        CRDoubleMatrixHelpers::deep_copy(&solid_block,
+                                         Solid_block_at_last_setup);
+        Nsolid_preconditioner_reuse = 0;
+      }
+      if (reuse_pseudo_elastic_preconditioner)
+      {
+        Npseudo_elastic_preconditioner_reuse++;
+      }
+      else
+      {
+        Pseudo_elastic_preconditioner_pt->clean_up_memory();
+        CRDoubleMatrixHelpers::deep_copy(&pseudo_elastic_block,
+                                         Pseudo_elastic_block_at_last_setup);
+        CRDoubleMatrixHelpers::deep_copy(
+          &lagrange_multiplier_block, Lagrange_multiplier_block_at_last_setup);
+        Npseudo_elastic_preconditioner_reuse = 0;
+      }
+    }
+    double t_reuse_check = TimingHelpers::timer();
 
     // SETUP THE PRECONDITIONERS
     // =========================
@@ -168,10 +249,15 @@ namespace oomph
       delete ns_matrix_pt;
       ns_matrix_pt = 0;
     }
+    double t_fluid = TimingHelpers::timer();
 
     // next the solid preconditioner
-    if (dynamic_cast<BlockPreconditioner<CRDoubleMatrix>*>(
-          Solid_preconditioner_pt) != 0)
+    if (reuse_solid_preconditioner)
+    {
+      // Nothing to be done
+    }
+    else if (dynamic_cast<BlockPreconditioner<CRDoubleMatrix>*>(
+               Solid_preconditioner_pt) != 0)
     {
       Solid_preconditioner_is_block_preconditioner = true;
       GeneralPurposeBlockPreconditioner<CRDoubleMatrix>*
@@ -213,27 +299,36 @@ namespace oomph
       delete s_matrix_pt;
       s_matrix_pt = 0;
     }
+    double t_solid = TimingHelpers::timer();
 
     // next the pseudo solid preconditioner
-    unsigned ndof_for_pseudo_elastic_prec = Dim * 3;
-    Vector<unsigned> pseudo_elastic_prec_dof_list(ndof_for_pseudo_elastic_prec,
-                                                  0);
-    for (unsigned i = 0; i < Dim * 2; i++)
+    if (!reuse_pseudo_elastic_preconditioner)
     {
-      pseudo_elastic_prec_dof_list[i] = nfluid_dof + i;
-    }
-    for (unsigned i = 0; i < Dim; i++)
-    {
-      pseudo_elastic_prec_dof_list[i + Dim * 2] =
-        nfluid_dof + npseudo_elastic_dof + nsolid_dof + i;
+      unsigned ndof_for_pseudo_elastic_prec = Dim * 3;
+      Vector<unsigned> pseudo_elastic_prec_dof_list(
+        ndof_for_pseudo_elastic_prec, 0);
+      for (unsigned i = 0; i < Dim * 2; i++)
+      {
+        pseudo_elastic_prec_dof_list[i] = nfluid_dof + i;
+      }
+      for (unsigned i = 0; i < Dim; i++)
+      {
+        pseudo_elastic_prec_dof_list[i + Dim * 2] =
+          nfluid_dof + npseudo_elastic_dof + nsolid_dof + i;
+      }
+      Pseudo_elastic_preconditioner_pt
+        ->turn_into_subsidiary_block_preconditioner(
+          this, pseudo_elastic_prec_dof_list);
+      Pseudo_elastic_preconditioner_pt->set_elastic_mesh(
+        this->Fluid_and_pseudo_elastic_mesh_pt);
+      Pseudo_elastic_preconditioner_pt->set_lagrange_multiplier_mesh(
+        this->Lagrange_multiplier_mesh_pt);
+      Pseudo_elastic_preconditioner_pt->Preconditioner::setup(matrix_pt());
     }
-    Pseudo_elastic_preconditioner_pt->turn_into_subsidiary_block_preconditioner(
-      this, pseudo_elastic_prec_dof_list);
-    Pseudo_elastic_preconditioner_pt->set_elastic_mesh(
-      this->Fluid_and_pseudo_elastic_mesh_pt);
-    Pseudo_elastic_preconditioner_pt->set_lagrange_multiplier_mesh(
-      this->Lagrange_multiplier_mesh_pt);
-    Pseudo_elastic_preconditioner_pt->Preconditioner::setup(matrix_pt());
+    double t_pseudo_elastic = TimingHelpers::timer();
+
+    // The subsidiary preconditioners can now be re-used
+    Subsidiary_preconditioners_have_been_setup = true;
 
     // SETUP THE MATRIX VECTOR PRODUCT OPERATORS
     // =========================================
@@ -272,6 +367,40 @@ namespace oomph
       Lagrange_solid_matvec_pt, ls_matrix_pt, 1);
     delete ls_matrix_pt;
     ls_matrix_pt = 0;
+    double t_end = TimingHelpers::timer();
+
+    // Output times
+    if (Doc_time)
+    {
+      oomph_info << "Block setup time [sec]: " << t_block_setup - t_start
+                 << "\n";
+      if (Reuse_solid_and_pseudo_elastic_preconditioners)
+      {
+        oomph_info << "Time for assessing re-use of preconditioners [sec]: "
+                   << t_reuse_check - t_block_setup << "\n";
+      }
+      oomph_info << "Fluid sub-preconditioner setup time [sec]: "
+                 << t_fluid - t_reuse_check << "\n";
+      oomph_info << "Solid sub-preconditioner setup time [sec]: "
+                 << t_solid - t_fluid;
+      if (reuse_solid_preconditioner)
+      {
+        oomph_info << " (re-used; relative change in solid block: "
+                   << solid_block_change << ")";
+      }
+      oomph_info << "\n";
+      oomph_info << "Pseudo-elastic sub-preconditioner setup time [sec]: "
+                 << t_pseudo_elastic - t_solid;
+      if (reuse_pseudo_elastic_preconditioner)
+      {
+        oomph_info << " (re-used; relative change in pseudo-elastic and "
+                   << "Lagrange multiplier blocks: "
+                   << pseudo_elastic_block_change << ")";
+      }
+      oomph_info << "\n";
+      oomph_info << "Coupling matrix-vector product setup time [sec]: "
+                 << t_end - t_pseudo_elastic << "\n";
+    }
   }
 
   //=============================================================================
@@ -96,6 +96,17 @@ namespace oomph
       Solid_pseudo_elastic_matvec_pt = new MatrixVectorProduct;
       Fluid_pseudo_elastic_matvec_pt = new MatrixVectorProduct;
       Lagrange_solid_matvec_pt = new MatrixVectorProduct;
+
+      // By default, set up all subsidiary preconditioners from scratch
+      Reuse_solid_and_pseudo_elastic_preconditioners = false;
+      Reuse_tolerance = 0.1;
+      Max_nreuse = 10;
+      Nsolid_preconditioner_reuse = 0;
+      Npseudo_elastic_preconditioner_reuse = 0;
+      Subsidiary_preconditioners_have_been_setup = false;
+
+      // Don't doc timings by default
+      Doc_time = false;
     }
 
     // destructor
@@ -178,6 +189,9 @@ namespace oomph
       }
       Solid_preconditioner_pt = prec_pt;
       Using_default_solid_preconditioner = false;
+
+      // The new preconditioner has to be set up from scratch
+      Solid_block_at_last_setup.clear();
     }
 
     /// Access function to the pseudo elastic subsidiary preconditioner
@@ -206,6 +220,45 @@ namespace oomph
       Use_navier_stokes_schur_complement_preconditioner = false;
     }
 
+    /// \short Re-use the solid and pseudo-elastic subsidiary preconditioners
+    /// (i.e. don't set them up again) for as long as the relative change
+    /// (in the Frobenius norm) of the solid and pseudo-elastic blocks,
+    /// respectively, since they were last set up is less than tol, but for
+    /// at most max_nreuse consecutive setups. (For the pseudo-elastic
+    /// preconditioner the blocks that couple the Lagrange multipliers to
+    /// the pseudo-elastic dofs must not have changed by more than tol
+    /// either.) The fluid preconditioner
+    /// and the coupling matrix-vector products are always re-computed.
+    void enable_solid_and_pseudo_elastic_preconditioner_reuse(
+      const double& tol = 0.1, const unsigned& max_nreuse = 10)
+    {
+      Reuse_solid_and_pseudo_elastic_preconditioners = true;
+      Reuse_tolerance = tol;
+      Max_nreuse = max_nreuse;
+    }
+
+    /// \short Set up all subsidiary preconditioners from scratch every time
+    /// (default)
+    void disable_solid_and_pseudo_elastic_preconditioner_reuse()
+    {
+      Reuse_solid_and_pseudo_elastic_preconditioners = false;
+      Solid_block_at_last_setup.clear();
+      Pseudo_elastic_block_at_last_setup.clear();
+      Lagrange_multiplier_block_at_last_setup.clear();
+    }
+
+    /// Enable documentation of setup times of the subsidiary preconditioners
+    void enable_doc_time()
+    {
+      Doc_time = true;
+    }
+
+    /// Disable documentation of setup times of the subsidiary preconditioners
+    void disable_doc_time()
+    {
+      Doc_time = false;
+    }
+
   private:
     /// \short pointer to the pseudo solid preconditioner
     PseudoElasticPreconditioner* Pseudo_elastic_preconditioner_pt;
@@ -257,6 +310,48 @@ namespace oomph
     /// Navier Stokes subsidiary system.
     bool Use_navier_stokes_schur_complement_preconditioner;
 
+    /// \short If true the solid and pseudo-elastic preconditioners are
+    /// re-used if their blocks haven't changed much since they were
+    /// last set up
+    bool Reuse_solid_and_pseudo_elastic_preconditioners;
+
+    /// \short Max. relative change (in the Frobenius norm) of the solid and
+    /// pseudo-elastic blocks for which their preconditioners are re-used
+    double Reuse_tolerance;
+
+    /// \short Max. number of consecutive setups for which the solid and
+    /// pseudo-elastic preconditioners are re-used
+    unsigned Max_nreuse;
+
+    /// \short Number of consecutive setups for which the solid preconditioner
+    /// has been re-used
+    unsigned Nsolid_preconditioner_reuse;
+
+    /// \short Number of consecutive setups for which the pseudo-elastic
+    /// preconditioner has been re-used
+    unsigned Npseudo_elastic_preconditioner_reuse;
+
+    /// \short Have the subsidiary preconditioners been set up (so they can
+    /// be re-used)?
+    bool Subsidiary_preconditioners_have_been_setup;
+
+    /// \short Copy of the solid block for which the solid preconditioner
+    /// was last set up
+    CRDoubleMatrix Solid_block_at_last_setup;
+
+    /// \short Copy of the pseudo-elastic block for which the pseudo-elastic
+    /// preconditioner was last set up
+    CRDoubleMatrix Pseudo_elastic_block_at_last_setup;
+
+    /// \short Copy of the block that couples the Lagrange multipliers to the
+    /// pseudo-elastic dofs for which the pseudo-elastic preconditioner
+    /// was last set up
+    CRDoubleMatrix Lagrange_multiplier_block_at_last_setup;
+
+    /// \short Set Doc_time to true for outputting the setup times of the
+    /// subsidiary preconditioners
+    bool Doc_time;
+
   }; // end of class FSILagrangeMultiplierPreconditioner
 
 } // namespace oomph
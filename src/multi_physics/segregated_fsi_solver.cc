@@ -353,6 +353,14 @@ namespace oomph
   //============================================================================
   void SegregatableFSIProblem::under_relax_solid()
   {
+    // Interface quasi-Newton acceleration
+    //------------------------------------
+    if (Use_iqn_ils)
+    {
+      iqn_ils_update_solid();
+      return;
+    }
+
     // Irons and Tuck extrapolation/relaxation; an extension of Aitken's method
     //-------------------------------------------------------------------------
     if (Use_irons_and_tuck_extrapolation)
@@ -484,6 +492,206 @@ namespace oomph
     }
   }
 
+  //============================================================================
+  /// Interface quasi-Newton update of the solid variables (IQN-ILS).
+  /// Denoting the solid values at the start of the current coupling
+  /// iteration by x (stored in Previous_solid_value) and the solid
+  /// solver's prediction by x_tilde, the interface residual is
+  /// r = x_tilde - x. The differences between successive residuals
+  /// (columns of V) and predictions (columns of W) provide a low-rank
+  /// approximation of the inverse Jacobian of the interface residual.
+  /// The new iterate is x_new = x_tilde + W c, where c minimises
+  /// || V c + r ||_2; the least-squares problem is solved by a QR
+  /// decomposition of V (modified Gram-Schmidt), during which
+  /// (near-)linearly dependent columns are discarded. If no columns are
+  /// available yet we take an under-relaxed step x_new = x + omega r.
+  //============================================================================
+  void SegregatableFSIProblem::iqn_ils_update_solid()
+  {
+    // Number of solid values
+    const unsigned n_value_total = Previous_solid_value.size();
+
+    // Get the prediction from the solid solver and the interface residual
+    Vector<double> solid_value(n_value_total);
+    Vector<double> residual(n_value_total);
+    unsigned value_count = 0;
+    const unsigned n_data = Solid_data_pt.size();
+    for (unsigned i = 0; i < n_data; i++)
+    {
+      const unsigned n_value = Solid_data_pt[i]->nvalue();
+      for (unsigned k = 0; k < n_value; k++)
+      {
+        solid_value[value_count] = Solid_data_pt[i]->value(k);
+        residual[value_count] =
+          solid_value[value_count] - Previous_solid_value[value_count];
+        value_count++;
+      }
+    }
+
+    // Add new column to the quasi-Newton approximation
+    if (Iqn_ils_has_previous_iterate)
+    {
+      Vector<double> residual_difference(n_value_total);
+      Vector<double> solid_value_difference(n_value_total);
+      for (unsigned j = 0; j < n_value_total; j++)
+      {
+        residual_difference[j] = residual[j] - Iqn_ils_previous_residual[j];
+        solid_value_difference[j] =
+          solid_value[j] - Iqn_ils_previous_solid_value[j];
+      }
+      Iqn_ils_residual_difference.push_back(residual_difference);
+      Iqn_ils_solid_value_difference.push_back(solid_value_difference);
+      Iqn_ils_column_solve_id.push_back(Iqn_ils_solve_count);
+
+      // Discard the oldest column if we have too many
+      if (Iqn_ils_residual_difference.size() > Max_iqn_ils_column)
+      {
+        Iqn_ils_residual_difference.erase(Iqn_ils_residual_difference.begin());
+        Iqn_ils_solid_value_difference.erase(
+          Iqn_ils_solid_value_difference.begin());
+        Iqn_ils_column_solve_id.erase(Iqn_ils_column_solve_id.begin());
+      }
+    }
+
+    // Store residual and prediction for the next iteration
+    Iqn_ils_previous_residual = residual;
+    Iqn_ils_previous_solid_value = solid_value;
+    Iqn_ils_has_previous_iterate = true;
+
+    // New solid values
+    Vector<double> new_solid_value(n_value_total);
+
+    // Number of columns
+    const unsigned n_column = Iqn_ils_residual_difference.size();
+
+    // No information yet: Under-relaxed fixed point step
+    if (n_column == 0)
+    {
+      for (unsigned j = 0; j < n_value_total; j++)
+      {
+        new_solid_value[j] =
+          Previous_solid_value[j] + Omega_relax * residual[j];
+      }
+      Iqn_ils_ncolumn_used = 0;
+    }
+    // Quasi-Newton step
+    else
+    {
+      // QR decomposition of V by modified Gram-Schmidt, starting with the
+      // most recent column. q[a] is the a-th orthonormal vector;
+      // r_matrix[a][b] (b<=a) the entries of the a-th column of R
+      Vector<Vector<double>> q;
+      Vector<Vector<double>> r_matrix;
+      Vector<unsigned> accepted_column;
+      std::vector<bool> discard_column(n_column, false);
+      for (int j = int(n_column) - 1; j >= 0; j--)
+      {
+        Vector<double> v(Iqn_ils_residual_difference[j]);
+        double norm_orig = 0.0;
+        for (unsigned l = 0; l < n_value_total; l++)
+        {
+          norm_orig += v[l] * v[l];
+        }
+        norm_orig = sqrt(norm_orig);
+
+        // Orthogonalise against the columns accepted so far
+        const unsigned n_accepted = q.size();
+        Vector<double> r_column(n_accepted + 1, 0.0);
+        for (unsigned a = 0; a < n_accepted; a++)
+        {
+          double dot = 0.0;
+          for (unsigned l = 0; l < n_value_total; l++)
+          {
+            dot += q[a][l] * v[l];
+          }
+          r_column[a] = dot;
+          for (unsigned l = 0; l < n_value_total; l++)
+          {
+            v[l] -= dot * q[a][l];
+          }
+        }
+        double norm = 0.0;
+        for (unsigned l = 0; l < n_value_total; l++)
+        {
+          norm += v[l] * v[l];
+        }
+        norm = sqrt(norm);
+
+        // Filter out (near-)linearly dependent columns
+        if ((norm_orig == 0.0) || (norm < Iqn_ils_filter_tolerance * norm_orig))
+        {
+          discard_column[j] = true;
+          continue;
+        }
+        for (unsigned l = 0; l < n_value_total; l++)
+        {
+          v[l] /= norm;
+        }
+        r_column[n_accepted] = norm;
+        q.push_back(v);
+        r_matrix.push_back(r_column);
+        accepted_column.push_back(unsigned(j));
+      }
+
+      // Solve R c = -Q^T r by back substitution
+      const unsigned n_accepted = q.size();
+      Vector<double> c(n_accepted, 0.0);
+      for (int a = int(n_accepted) - 1; a >= 0; a--)
+      {
+        double rhs = 0.0;
+        for (unsigned l = 0; l < n_value_total; l++)
+        {
+          rhs -= q[a][l] * residual[l];
+        }
+        for (unsigned b = a + 1; b < n_accepted; b++)
+        {
+          rhs -= r_matrix[b][a] * c[b];
+        }
+        c[a] = rhs / r_matrix[a][a];
+      }
+
+      // New solid values: x_new = x_tilde + W c
+      new_solid_value = solid_value;
+      for (unsigned a = 0; a < n_accepted; a++)
+      {
+        const Vector<double>& w =
+          Iqn_ils_solid_value_difference[accepted_column[a]];
+        for (unsigned l = 0; l < n_value_total; l++)
+        {
+          new_solid_value[l] += c[a] * w[l];
+        }
+      }
+      Iqn_ils_ncolumn_used = n_accepted;
+
+      // Remove the discarded columns (backwards so the indices stay valid)
+      for (int j = int(n_column) - 1; j >= 0; j--)
+      {
+        if (discard_column[j])
+        {
+          Iqn_ils_residual_difference.erase(
+            Iqn_ils_residual_difference.begin() + j);
+          Iqn_ils_solid_value_difference.erase(
+            Iqn_ils_solid_value_difference.begin() + j);
+          Iqn_ils_column_solve_id.erase(Iqn_ils_column_solve_id.begin() + j);
+          Iqn_ils_ncolumn_filtered++;
+        }
+      }
+    }
+
+    // Assign the new values
+    value_count = 0;
+    for (unsigned i = 0; i < n_data; i++)
+    {
+      const unsigned n_value = Solid_data_pt[i]->nvalue();
+      for (unsigned k = 0; k < n_value; k++)
+      {
+        Solid_data_pt[i]->set_value(k, new_solid_value[value_count]);
+        value_count++;
+      }
+    }
+  }
+
+
   //============================================================================
   /// Pointwise Aitken extrapolation for solid variables
   //============================================================================
@@ -560,6 +768,27 @@ namespace oomph
     // Update anything that needs updating
     actions_before_segregated_solve();
 
+    // Start a new set of quasi-Newton iterations: Discard the information
+    // from segregated solves that are too old to be re-used
+    if (Use_iqn_ils)
+    {
+      Iqn_ils_solve_count++;
+      Iqn_ils_has_previous_iterate = false;
+      Iqn_ils_ncolumn_used = 0;
+      Iqn_ils_ncolumn_filtered = 0;
+      for (int j = int(Iqn_ils_column_solve_id.size()) - 1; j >= 0; j--)
+      {
+        if (Iqn_ils_solve_count - Iqn_ils_column_solve_id[j] > N_iqn_ils_reuse)
+        {
+          Iqn_ils_residual_difference.erase(
+            Iqn_ils_residual_difference.begin() + j);
+          Iqn_ils_solid_value_difference.erase(
+            Iqn_ils_solid_value_difference.begin() + j);
+          Iqn_ils_column_solve_id.erase(Iqn_ils_column_solve_id.begin() + j);
+        }
+      }
+    }
+
     // Set flags to values that are appropriate if Picard iteration
     // does not converge with Max_picard iterations
     bool converged = false;
@@ -880,6 +1109,13 @@ namespace oomph
     // Final tolerance achieved by the iteration
     conv_data.tol_achieved() = tol_achieved;
 
+    // Stats for the interface quasi-Newton acceleration
+    if (Use_iqn_ils)
+    {
+      conv_data.nquasi_newton_column() = Iqn_ils_ncolumn_used;
+      conv_data.nquasi_newton_column_filtered() = Iqn_ils_ncolumn_filtered;
+    }
+
     // Doc non-convergence
     if (!converged)
     {
@@ -1214,6 +1450,10 @@ namespace oomph
       Pointwise_aitken_solid_value.clear();
       Del_irons_and_tuck.clear();
 
+      // The layout of the solid dofs may have changed, so the
+      // quasi-Newton information can't be re-used
+      clear_iqn_ils_history();
+
 
       unsigned n_solid_data = solid_data_pt.size();
 
@@ -46,7 +46,9 @@ namespace oomph
         Essential_cpu_total(0.0),
         CPU_for_global_residual(0.0),
         Tol_achieved(0.0),
-        Has_converged(false)
+        Has_converged(false),
+        Nquasi_newton_column(0),
+        Nquasi_newton_column_filtered(0)
     {
     }
 
@@ -106,6 +108,22 @@ namespace oomph
       Has_converged = false;
     }
 
+    /// \short Number of columns in the interface quasi-Newton
+    /// approximation used in the final coupling iteration (zero if
+    /// quasi-Newton acceleration is not used)
+    unsigned& nquasi_newton_column()
+    {
+      return Nquasi_newton_column;
+    }
+
+    /// \short Number of (near-)linearly dependent columns that were
+    /// filtered out of the interface quasi-Newton approximation
+    /// during the solve
+    unsigned& nquasi_newton_column_filtered()
+    {
+      return Nquasi_newton_column_filtered;
+    }
+
   private:
     /// Number of iterations performed
     unsigned Niter;
@@ -129,6 +147,14 @@ namespace oomph
 
     /// Flag to indicate if the solver has converged
     bool Has_converged;
+
+    /// \short Number of columns in the interface quasi-Newton
+    /// approximation used in the final coupling iteration
+    unsigned Nquasi_newton_column;
+
+    /// \short Number of columns filtered out of the interface quasi-Newton
+    /// approximation during the solve
+    unsigned Nquasi_newton_column_filtered;
   };
 
 
@@ -199,6 +225,25 @@ namespace oomph
       // Don't use of Irons and Tuck's extrapolation for solid values
       Use_irons_and_tuck_extrapolation = false;
 
+      // Don't use interface quasi-Newton acceleration
+      Use_iqn_ils = false;
+
+      // Max. number of columns in the quasi-Newton approximation
+      Max_iqn_ils_column = 100;
+
+      // Number of previous segregated solves whose quasi-Newton
+      // information is re-used
+      N_iqn_ils_reuse = 0;
+
+      // Tolerance for filtering of linearly dependent columns
+      Iqn_ils_filter_tolerance = 1.0e-8;
+
+      // Initialise the quasi-Newton bookkeeping
+      Iqn_ils_solve_count = 0;
+      Iqn_ils_has_previous_iterate = false;
+      Iqn_ils_ncolumn_used = 0;
+      Iqn_ils_ncolumn_filtered = 0;
+
       // Start using pointwise Aitken immediately
       Pointwise_aitken_start = 0;
 
@@ -405,6 +450,57 @@ namespace oomph
       Use_irons_and_tuck_extrapolation = false;
     }
 
+    /// \short Use interface quasi-Newton acceleration with a least-squares
+    /// approximation of the inverse Jacobian of the interface residual
+    /// (IQN-ILS; Degroote et al.) for the solid dofs. The approximation is
+    /// built from the differences between successive solid predictions and
+    /// interface residuals. The information gathered during the previous
+    /// n_reuse segregated solves (typically timesteps) is re-used.
+    /// The first iteration of each solve is under-relaxed with the
+    /// parameter set by enable_under_relaxation(...). This replaces
+    /// pointwise Aitken and Irons and Tuck extrapolation, which
+    /// are disabled.
+    void enable_iqn_ils_acceleration(const unsigned& n_reuse = 0)
+    {
+      Use_iqn_ils = true;
+      N_iqn_ils_reuse = n_reuse;
+      Use_irons_and_tuck_extrapolation = false;
+      Use_pointwise_aitken = false;
+    }
+
+    /// \short Do not use interface quasi-Newton acceleration
+    void disable_iqn_ils_acceleration()
+    {
+      Use_iqn_ils = false;
+      clear_iqn_ils_history();
+    }
+
+    /// \short Max. number of columns retained in the interface
+    /// quasi-Newton approximation (default: 100). The oldest columns are
+    /// discarded first.
+    unsigned& max_iqn_ils_column()
+    {
+      return Max_iqn_ils_column;
+    }
+
+    /// \short Tolerance used to filter (near-)linearly dependent columns
+    /// out of the interface quasi-Newton approximation during its QR
+    /// decomposition (relative to the norm of the column; default: 1e-8)
+    double& iqn_ils_filter_tolerance()
+    {
+      return Iqn_ils_filter_tolerance;
+    }
+
+    /// \short Wipe the information stored for the interface
+    /// quasi-Newton approximation
+    void clear_iqn_ils_history()
+    {
+      Iqn_ils_residual_difference.clear();
+      Iqn_ils_solid_value_difference.clear();
+      Iqn_ils_column_solve_id.clear();
+      Iqn_ils_has_previous_iterate = false;
+    }
+
     /// Enumerated flags for convergence criteria
     enum convergence_criteria
     {
@@ -518,6 +614,10 @@ namespace oomph
     /// Do pointwise Aitken extrapolation for solid
     void pointwise_aitken_extrapolate();
 
+    /// \short Update the solid dofs by an interface quasi-Newton (IQN-ILS)
+    /// step, based on the most recent prediction by the solid solver
+    void iqn_ils_update_solid();
+
     /// \short Vector storing the Data objects associated with the fluid
     /// problem: Tyically the nodal and internal data of the elements in the
     /// fluid bulk mesh
@@ -566,12 +666,59 @@ namespace oomph
     /// Have we just done a pointwise Aitken step
     bool Recheck_convergence_after_pointwise_aitken;
 
+    /// Use interface quasi-Newton (IQN-ILS) acceleration?
+    bool Use_iqn_ils;
+
+    /// Max. number of columns in the quasi-Newton approximation
+    unsigned Max_iqn_ils_column;
+
+    /// \short Number of previous segregated solves whose quasi-Newton
+    /// information is re-used
+    unsigned N_iqn_ils_reuse;
+
+    /// \short Tolerance for filtering of linearly dependent columns in
+    /// the quasi-Newton approximation
+    double Iqn_ils_filter_tolerance;
+
+    /// \short Columns of the quasi-Newton approximation: Differences
+    /// between successive interface residuals
+    Vector<Vector<double>> Iqn_ils_residual_difference;
+
+    /// \short Columns of the quasi-Newton approximation: Differences
+    /// between successive predictions of the solid solver
+    Vector<Vector<double>> Iqn_ils_solid_value_difference;
+
+    /// \short Number of the segregated solve in which the corresponding
+    /// column of the quasi-Newton approximation was created
+    Vector<unsigned> Iqn_ils_column_solve_id;
+
+    /// Interface residual from the previous coupling iteration
+    Vector<double> Iqn_ils_previous_residual;
+
+    /// Prediction of the solid solver in the previous coupling iteration
+    Vector<double> Iqn_ils_previous_solid_value;
+
+    /// Number of segregated solves performed with quasi-Newton acceleration
+    unsigned Iqn_ils_solve_count;
+
+    /// \short Do we have an interface residual from a previous coupling
+    /// iteration within the current segregated solve?
+    bool Iqn_ils_has_previous_iterate;
+
+    /// \short Number of columns used in the most recent quasi-Newton update
+    unsigned Iqn_ils_ncolumn_used;
+
+    /// \short Number of columns filtered out during the current
+    /// segregated solve
+    unsigned Iqn_ils_ncolumn_filtered;
+
   private:
     /// Extrapolate solid data and update fluid mesh during unsteady run
     void extrapolate_solid_data();
 
     /// \short Under-relax the most recently computed solid variables, either
-    /// by classical relaxation or by Irons & Tuck
+    /// by classical relaxation, by Irons & Tuck or by an interface
+    /// quasi-Newton step
     void under_relax_solid();
 
     /// \short Only include fluid elements in the Problem's mesh. This is
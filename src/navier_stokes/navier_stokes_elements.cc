@@ -1820,6 +1820,11 @@ namespace oomph
     // Integers to store the local equations and unknowns
     int local_eqn = 0, local_unknown = 0;
 
+    // Storage for the position and body force (passed to the user-defined
+    // functions); allocated once rather than at every integration point
+    Vector<double> interpolated_x(DIM);
+    Vector<double> body_force(DIM);
+
     // Loop over the integration points
     for (unsigned ipt = 0; ipt < n_intpt; ipt++)
     {
@@ -1839,13 +1844,25 @@ namespace oomph
       double W = w * J;
 
       // Calculate local values of the pressure and velocity components
-      // Allocate
+      // Allocate (DIM is known at compile time, so these live on the
+      // stack) and initialise to zero
       double interpolated_p = 0.0;
-      Vector<double> interpolated_u(DIM, 0.0);
-      Vector<double> interpolated_x(DIM, 0.0);
-      Vector<double> mesh_velocity(DIM, 0.0);
-      Vector<double> dudt(DIM, 0.0);
-      DenseMatrix<double> interpolated_dudx(DIM, DIM, 0.0);
+      double interpolated_u[DIM];
+      double mesh_velocity[DIM];
+      double dudt[DIM];
+      double interpolated_dudx[DIM][DIM];
+      for (unsigned i = 0; i < DIM; i++)
+      {
+        interpolated_u[i] = 0.0;
+        interpolated_x[i] = 0.0;
+        mesh_velocity[i] = 0.0;
+        dudt[i] = 0.0;
+        body_force[i] = 0.0;
+        for (unsigned j = 0; j < DIM; j++)
+        {
+          interpolated_dudx[i][j] = 0.0;
+        }
+      }
 
       // Calculate pressure
       for (unsigned l = 0; l < n_pres; l++)
@@ -1868,7 +1885,7 @@ namespace oomph
           // Loop over derivative directions
           for (unsigned j = 0; j < DIM; j++)
           {
-            interpolated_dudx(i, j) += u_value * dpsifdx(l, j);
+            interpolated_dudx[i][j] += u_value * dpsifdx(l, j);
           }
         }
       }
@@ -1887,7 +1904,6 @@ namespace oomph
       }
 
       // Get the user-defined body force terms
-      Vector<double> body_force(DIM);
       get_body_force_nst(time, ipt, s, interpolated_x, body_force);
 
       // Get the user-defined source function
@@ -1924,7 +1940,7 @@ namespace oomph
             {
               residuals[local_eqn] -=
                 visc_ratio *
-                (interpolated_dudx(i, k) + Gamma[i] * interpolated_dudx(k, i)) *
+                (interpolated_dudx[i][k] + Gamma[i] * interpolated_dudx[k][i]) *
                 dtestfdx(l, k) * W;
             }
 
@@ -1939,7 +1955,7 @@ namespace oomph
               double tmp = scaled_re * interpolated_u[k];
               if (!ALE_is_disabled) tmp -= scaled_re_st * mesh_velocity[k];
               residuals[local_eqn] -=
-                tmp * interpolated_dudx(i, k) * testf[l] * W;
+                tmp * interpolated_dudx[i][k] * testf[l] * W;
             }
 
             // CALCULATE THE JACOBIAN
@@ -1973,7 +1989,7 @@ namespace oomph
 
                     // Now add in the inertial terms
                     jacobian(local_eqn, local_unknown) -=
-                      scaled_re * psif[l2] * interpolated_dudx(i, i2) *
+                      scaled_re * psif[l2] * interpolated_dudx[i][i2] *
                       testf[l] * W;
 
                     // Extra component if i2=i
@@ -2047,7 +2063,7 @@ namespace oomph
           for (unsigned k = 0; k < DIM; k++)
           {
             // residuals[local_eqn] += interpolated_dudx(k,k)*testp[l]*W;
-            aux += interpolated_dudx(k, k);
+            aux += interpolated_dudx[k][k];
           }
 
           residuals[local_eqn] += aux * testp[l] * W;
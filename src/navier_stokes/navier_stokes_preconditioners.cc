@@ -689,17 +689,21 @@ namespace oomph
     // Step 1 - apply approximate Schur inverse to pressure unknowns (block 1)
     // -----------------------------------------------------------------------
 
-    // Working vectors
-    DoubleVector temp_vec;
-    DoubleVector another_temp_vec;
-    DoubleVector yet_another_temp_vec;
+    // The work vectors are retained between calls so their storage
+    // can be re-used; each one always holds either pressure or velocity
+    // values so its distribution doesn't change.
 
-    // Copy pressure values from residual vector to temp_vec:
+    // Copy pressure values from residual vector to Pressure_work_vec:
     // Loop over all entries in the global vector (this one
     // includes velocity and pressure dofs in some random fashion)
-    this->get_block_vector(1, r, temp_vec);
+    this->get_block_vector(1, r, Pressure_work_vec);
 
-    // NOTE: The vector temp_vec now contains the vector r_p.
+    // NOTE: The vector Pressure_work_vec now contains the vector r_p.
+
+    // Pointer to the work vector that contains the solution of the Schur
+    // complement system, z_p, at the end of this step (its sign is fixed
+    // below)
+    DoubleVector* z_p_pt = 0;
 
     // LSC version
     if (Use_LSC)
@@ -718,39 +722,45 @@ namespace oomph
 #endif
 
       // use some Preconditioner's preconditioner_solve function
-      P_preconditioner_pt->preconditioner_solve(temp_vec, another_temp_vec);
-
-      // NOTE: The vector another_temp_vec now contains the vector P^{-1} r_p
+      // (zero the retained solution vector first, as it was before the
+      // work vectors were retained, in case the solver uses it as its
+      // initial guess)
+      Another_pressure_work_vec.initialise(0.0);
+      P_preconditioner_pt->preconditioner_solve(Pressure_work_vec,
+                                                Another_pressure_work_vec);
 
-      // Multiply another_temp_vec by matrix E and stick the result into
-      // temp_vec
-      temp_vec.clear();
-      QBt_mat_vec_pt->multiply(another_temp_vec, temp_vec);
-      another_temp_vec.clear();
-      F_mat_vec_pt->multiply(temp_vec, another_temp_vec);
-      temp_vec.clear();
-      QBt_mat_vec_pt->multiply_transpose(another_temp_vec, temp_vec);
+      // NOTE: The vector Another_pressure_work_vec now contains the vector
+      // P^{-1} r_p
 
+      // Multiply by matrix E = Bt Qv^{-1} F Qv^{-1} B and stick the result
+      // into Pressure_work_vec
+      QBt_mat_vec_pt->multiply(Another_pressure_work_vec, Velocity_work_vec);
+      F_mat_vec_pt->multiply(Velocity_work_vec, Another_velocity_work_vec);
+      QBt_mat_vec_pt->multiply_transpose(Another_velocity_work_vec,
+                                         Pressure_work_vec);
 
-      // NOTE: The vector temp_vec now contains E P^{-1} r_p
+      // NOTE: The vector Pressure_work_vec now contains E P^{-1} r_p
 
       // Solve second pressure Poisson system using preconditioner_solve
-      another_temp_vec.clear();
-      P_preconditioner_pt->preconditioner_solve(temp_vec, another_temp_vec);
+      Another_pressure_work_vec.initialise(0.0);
+      P_preconditioner_pt->preconditioner_solve(Pressure_work_vec,
+                                                Another_pressure_work_vec);
 
-      // NOTE: The vector another_temp_vec now contains z_p = P^{-1} E P^{-1}
-      // r_p
+      // NOTE: The vector Another_pressure_work_vec now contains
+      //       z_p = P^{-1} E P^{-1} r_p
       //       as required (apart from the sign which we'll fix in the
       //       next step.
+      z_p_pt = &Another_pressure_work_vec;
     }
     // Fp version
     else
     {
-      // Multiply temp_vec by matrix E and stick the result into
-      // yet_another_temp_vec
-      E_mat_vec_pt->multiply(temp_vec, yet_another_temp_vec);
+      // Multiply Pressure_work_vec by matrix E and stick the result into
+      // Another_pressure_work_vec
+      E_mat_vec_pt->multiply(Pressure_work_vec, Another_pressure_work_vec);
 
-      // NOTE: The vector yet_another_temp_vec now contains Fp Qp^{-1} r_p
+      // NOTE: The vector Another_pressure_work_vec now contains
+      // Fp Qp^{-1} r_p
 
       // Solve pressure Poisson system
 #ifdef PARANOID
@@ -766,45 +776,38 @@ namespace oomph
 #endif
 
       // Solve second pressure Poisson system using preconditioner_solve
-      another_temp_vec.clear();
-      P_preconditioner_pt->preconditioner_solve(yet_another_temp_vec,
-                                                another_temp_vec);
+      Pressure_work_vec.initialise(0.0);
+      P_preconditioner_pt->preconditioner_solve(Another_pressure_work_vec,
+                                                Pressure_work_vec);
 
-      // NOTE: The vector another_temp_vec now contains
+      // NOTE: The vector Pressure_work_vec now contains
       //       z_p = P^{-1} Fp Qp^{-1} r_p
       //       as required (apart from the sign which we'll fix in the
       //       next step.
+      z_p_pt = &Pressure_work_vec;
     }
 
-    // Now copy another_temp_vec (i.e. z_p) back into the global vector z.
-    // Loop over all entries in the global results vector z:
-    temp_vec.build(another_temp_vec.distribution_pt(), 0.0);
-    temp_vec -= another_temp_vec;
-    return_block_vector(1, temp_vec, z);
+    // Fix the sign (in place) and copy z_p back into the global vector z.
+    (*z_p_pt) *= -1.0;
+    DoubleVector& z_p = *z_p_pt;
+    return_block_vector(1, z_p, z);
 
 
     // Step 2 - apply preconditioner to velocity unknowns (block 0)
     // ------------------------------------------------------------
 
-    // Recall that another_temp_vec (computed above) contains the
-    // negative of the solution of the Schur complement systen, -z_p.
-    // Multiply by G (stored in Block_matrix_pt(0,1) and store
-    // result in temp_vec (vector resizes itself).
-    temp_vec.clear();
-    Bt_mat_vec_pt->multiply(another_temp_vec, temp_vec);
+    // Multiply z_p by G (stored in Block_matrix_pt(0,1) and store
+    // result in Velocity_work_vec
+    Bt_mat_vec_pt->multiply(z_p, Velocity_work_vec);
 
-    // NOTE: temp_vec now contains -G z_p
-
-    // The vector another_temp_vec is no longer needed -- re-use it to store
-    // velocity quantities:
-    another_temp_vec.clear();
+    // NOTE: Velocity_work_vec now contains G z_p
 
     // Loop over all enries in the global vector and find the
     // entries associated with the velocities:
-    get_block_vector(0, r, another_temp_vec);
-    another_temp_vec += temp_vec;
+    get_block_vector(0, r, Another_velocity_work_vec);
+    Another_velocity_work_vec -= Velocity_work_vec;
 
-    // NOTE:  The vector another_temp_vec now contains r_u - G z_p
+    // NOTE:  The vector Another_velocity_work_vec now contains r_u - G z_p
 
     // Solve momentum system
 #ifdef PARANOID
@@ -822,13 +825,15 @@ namespace oomph
     // and return
     if (F_preconditioner_is_block_preconditioner)
     {
-      return_block_vector(0, another_temp_vec, z);
+      return_block_vector(0, Another_velocity_work_vec, z);
       F_preconditioner_pt->preconditioner_solve(z, z);
     }
     else
     {
-      F_preconditioner_pt->preconditioner_solve(another_temp_vec, temp_vec);
-      return_block_vector(0, temp_vec, z);
+      Velocity_work_vec.initialise(0.0);
+      F_preconditioner_pt->preconditioner_solve(Another_velocity_work_vec,
+                                                Velocity_work_vec);
+      return_block_vector(0, Velocity_work_vec, z);
     }
   }
 
@@ -1673,6 +1678,12 @@ namespace oomph
   {
     if (Preconditioner_has_been_setup)
     {
+      // wipe the work vectors (their distributions may change)
+      Pressure_work_vec.clear();
+      Another_pressure_work_vec.clear();
+      Velocity_work_vec.clear();
+      Another_velocity_work_vec.clear();
+
       // delete matvecs
       delete Bt_mat_vec_pt;
       Bt_mat_vec_pt = 0;
@@ -1217,6 +1217,21 @@ namespace oomph
     /// MatrixVectorProduct operator for E = Fp Qp^{-1} (only for Fp variant)
     MatrixVectorProduct* E_mat_vec_pt;
 
+    /// \short Work vector (pressure dofs) for preconditioner_solve(...);
+    /// retained between calls to avoid repeated (re-)allocation
+    DoubleVector Pressure_work_vec;
+
+    /// \short Second work vector (pressure dofs) for
+    /// preconditioner_solve(...)
+    DoubleVector Another_pressure_work_vec;
+
+    /// \short Work vector (velocity dofs) for preconditioner_solve(...)
+    DoubleVector Velocity_work_vec;
+
+    /// \short Second work vector (velocity dofs) for
+    /// preconditioner_solve(...)
+    DoubleVector Another_velocity_work_vec;
+
     /// \short the pointer to the mesh of block preconditionable Navier
     /// Stokes elements.
     Mesh* Navier_stokes_mesh_pt;
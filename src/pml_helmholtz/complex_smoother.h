@@ -35,6 +35,103 @@
 // Namespace extension
 namespace oomph
 {
+  //====================================================================
+  /// Helper functions for the Helmholtz smoothers and solvers that work
+  /// with the real and imaginary parts of the system matrix.
+  //====================================================================
+  namespace ComplexSmootherHelpers
+  {
+    /// \short Compute the complex matrix-vector product soln=A*x where
+    /// matrices_pt[0] and matrices_pt[1] are the real and imaginary parts
+    /// of A, and x[0] and x[1] (soln[0] and soln[1]) the real and
+    /// imaginary parts of x (soln). If the matrices are not distributed,
+    /// real(soln) = A_r*x_r - A_c*x_c and imag(soln) = A_r*x_c + A_c*x_r
+    /// are computed in a single sweep over the rows, so each matrix is
+    /// only traversed once and no temporary vector is required.
+    /// Otherwise we use four distributed matrix-vector products.
+    inline void complex_matrix_multiplication(
+      const Vector<CRDoubleMatrix*>& matrices_pt,
+      const Vector<DoubleVector>& x,
+      Vector<DoubleVector>& soln)
+    {
+      // Distributed matrices: Use the (parallel) real matrix-vector
+      // products
+      if (matrices_pt[0]->distributed() || matrices_pt[1]->distributed())
+      {
+        // Store the value of A_r*x_r in the real part of soln
+        matrices_pt[0]->multiply(x[0], soln[0]);
+
+        // Store the value of A_r*x_c in the imaginary part of soln
+        matrices_pt[0]->multiply(x[1], soln[1]);
+
+        // Create a temporary vector
+        DoubleVector temp(matrices_pt[0]->distribution_pt(), 0.0);
+
+        // Calculate the value of A_c*x_c and subtract it from soln[0]
+        matrices_pt[1]->multiply(x[1], temp);
+        soln[0] -= temp;
+
+        // Calculate the value of A_c*x_r and add it to soln[1]
+        matrices_pt[1]->multiply(x[0], temp);
+        soln[1] += temp;
+        return;
+      }
+
+      // Make sure the output vectors are built with the right size (their
+      // values are overwritten below)
+      unsigned n_row = matrices_pt[0]->nrow();
+      for (unsigned i = 0; i < 2; i++)
+      {
+        if ((!soln[i].built()) || (soln[i].nrow_local() != n_row))
+        {
+          soln[i].build(matrices_pt[0]->distribution_pt(), 0.0);
+        }
+      }
+
+      // Real part of the matrix
+      const int* real_row_start = matrices_pt[0]->row_start();
+      const int* real_column_index = matrices_pt[0]->column_index();
+      const double* real_value = matrices_pt[0]->value();
+
+      // Imaginary part of the matrix
+      const int* imag_row_start = matrices_pt[1]->row_start();
+      const int* imag_column_index = matrices_pt[1]->column_index();
+      const double* imag_value = matrices_pt[1]->value();
+
+      const double* x_real = x[0].values_pt();
+      const double* x_imag = x[1].values_pt();
+      double* soln_real = soln[0].values_pt();
+      double* soln_imag = soln[1].values_pt();
+
+      for (unsigned i = 0; i < n_row; i++)
+      {
+        double sum_real = 0.0;
+        double sum_imag = 0.0;
+
+        // Contribution from A_r
+        for (int k = real_row_start[i]; k < real_row_start[i + 1]; k++)
+        {
+          const int j = real_column_index[k];
+          sum_real += real_value[k] * x_real[j];
+          sum_imag += real_value[k] * x_imag[j];
+        }
+
+        // Contribution from A_c
+        for (int k = imag_row_start[i]; k < imag_row_start[i + 1]; k++)
+        {
+          const int j = imag_column_index[k];
+          sum_real -= imag_value[k] * x_imag[j];
+          sum_imag += imag_value[k] * x_real[j];
+        }
+
+        soln_real[i] = sum_real;
+        soln_imag[i] = sum_imag;
+      }
+    }
+
+  } // namespace ComplexSmootherHelpers
+
+
   //====================================================================
   /// Helmholtz smoother class:
   /// The smoother class is designed for the Helmholtz equation to be used
@@ -120,42 +217,9 @@ namespace oomph
       }
 #endif
 
-      //-----------------------------------------------------------------------
-      // Suppose we have a complex matrix, A, and two complex vectors, x and
-      // soln. We wish to compute the product A*x=soln (note, * does not mean
-      // we are using complex conjugates here, it is simply used to indicate
-      // a multiplication). To do this we must make use of the fact that we
-      // possess the real and imaginary separately. As a result, it is computed
-      // using:
-      //           soln = A*x,
-      //                = (A_r + i*A_c)*(x_r + i*x_c),
-      //                = [A_r*x_r - A_c*x_c] + i*[A_r*x_c + A_c*x_r],
-      // ==> real(soln) = A_r*x_r - A_c*x_c,
-      //   & imag(soln) = A_r*x_c + A_c*x_r,
-      // where the subscripts _r and _c are used to identify the real and
-      // imaginary part, respectively.
-      //-----------------------------------------------------------------------
-
-      // Store the value of A_r*x_r in the real part of soln
-      matrices_pt[0]->multiply(x[0], soln[0]);
-
-      // Store the value of A_r*x_c in the imaginary part of soln
-      matrices_pt[0]->multiply(x[1], soln[1]);
-
-      // Create a temporary vector
-      DoubleVector temp(this->distribution_pt(), 0.0);
-
-      // Calculate the value of A_c*x_c
-      matrices_pt[1]->multiply(x[1], temp);
-
-      // Subtract the value of temp from soln[0] to get the real part of soln
-      soln[0] -= temp;
-
-      // Calculate the value of A_c*x_r
-      matrices_pt[1]->multiply(x[0], temp);
-
-      // Add the value of temp to soln[1] to get the imaginary part of soln
-      soln[1] += temp;
+      // Compute the product in a single sweep (if possible)
+      ComplexSmootherHelpers::complex_matrix_multiplication(
+        matrices_pt, x, soln);
     } // End of complex_matrix_multiplication
 
     /// \short Self-test to check that all the dimensions of the inputs to
@@ -2196,42 +2260,9 @@ namespace oomph
       // code can be written at a later time to build the vectors if they're
       // not already built.
 
-      //-----------------------------------------------------------------------
-      // Suppose we have a complex matrix, A, and two complex vectors, x and
-      // soln. We wish to compute the product A*x=soln (note, * does not mean
-      // we are using complex conjugates here, it is simply used to indicate
-      // a multiplication). To do this we must make use of the fact that we
-      // possess the real and imaginary separately. As a result, it is computed
-      // using:
-      //           soln = A*x,
-      //                = (A_r + i*A_c)*(x_r + i*x_c),
-      //                = [A_r*x_r - A_c*x_c] + i*[A_r*x_c + A_c*x_r],
-      // ==> real(soln) = A_r*x_r - A_c*x_c,
-      //   & imag(soln) = A_r*x_c + A_c*x_r,
-      // where the subscripts _r and _c are used to identify the real and
-      // imaginary part, respectively.
-      //-----------------------------------------------------------------------
-
-      // Store the value of A_r*x_r in the real part of soln
-      matrices_pt[0]->multiply(x[0], soln[0]);
-
-      // Store the value of A_r*x_c in the imaginary part of soln
-      matrices_pt[0]->multiply(x[1], soln[1]);
-
-      // Create a temporary vector
-      DoubleVector temp(Matrices_storage_pt[0]->distribution_pt(), 0.0);
-
-      // Calculate the value of A_c*x_c
-      matrices_pt[1]->multiply(x[1], temp);
-
-      // Subtract the value of temp from soln[0] to get the real part of soln
-      soln[0] -= temp;
-
-      // Calculate the value of A_c*x_r
-      matrices_pt[1]->multiply(x[0], temp);
-
-      // Add the value of temp to soln[1] to get the imaginary part of soln
-      soln[1] += temp;
+      // Compute the product in a single sweep (if possible)
+      ComplexSmootherHelpers::complex_matrix_multiplication(
+        matrices_pt, x, soln);
     } // End of complex_matrix_multiplication
 
     /// Helper function to update the result vector
@@ -0,0 +1,1062 @@
+// LIC// ====================================================================
+// LIC// This file forms part of oomph-lib, the object-oriented,
+// LIC// multi-physics finite-element library, available
+// LIC// at http://www.oomph-lib.org.
+// LIC//
+// LIC// Copyright (C) 2006-2021 Matthias Heil and Andrew Hazel
+// LIC//
+// LIC// This library is free software; you can redistribute it and/or
+// LIC// modify it under the terms of the GNU Lesser General Public
+// LIC// License as published by the Free Software Foundation; either
+// LIC// version 2.1 of the License, or (at your option) any later version.
+// LIC//
+// LIC// This library is distributed in the hope that it will be useful,
+// LIC// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// LIC// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// LIC// Lesser General Public License for more details.
+// LIC//
+// LIC// You should have received a copy of the GNU Lesser General Public
+// LIC// License along with this library; if not, write to the Free Software
+// LIC// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+// LIC// 02110-1301  USA.
+// LIC//
+// LIC// The authors may be contacted at oomph-lib@maths.man.ac.uk.
+// LIC//
+// LIC//====================================================================
+// Include guards
+#ifndef OOMPH_HELMHOLTZ_ALGEBRAIC_MULTIGRID_HEADER
+#define OOMPH_HELMHOLTZ_ALGEBRAIC_MULTIGRID_HEADER
+
+// Config header generated by autoconfig
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+// Oomph-lib headers
+#include "generic/problem.h"
+#include "generic/matrices.h"
+#include "generic/preconditioner.h"
+
+// Include the complex smoother
+#include "complex_smoother.h"
+
+// Namespace extension
+namespace oomph
+{
+  //======================================================================
+  /// \short Algebraic multigrid preconditioner for the (complex-shifted)
+  /// PML Helmholtz equations. Unlike HelmholtzMGPreconditioner it does
+  /// not require a hierarchy of tree-based refineable meshes, so it
+  /// can be used with unstructured (e.g. TriangleMesh or TetgenMesh)
+  /// meshes. The Jacobian is assumed to have the block form
+  ///                       |-----|------|
+  ///                       | A_r | -A_c |
+  ///                   A = |-----|------|
+  ///                       | A_c |  A_r |
+  ///                       |-----|------|
+  /// On the finest level we use the complex-shifted Laplacian (the
+  /// Jacobian recomputed with the PML elements' alpha set to
+  /// alpha_shift(); the unshifted Jacobian is used if the shift is
+  /// zero). The coarse levels are constructed algebraically:
+  /// The unknowns are grouped into aggregates of strongly coupled
+  /// unknowns (based on the entries of A_r) and the (piecewise constant)
+  /// interpolation from each aggregate is used to form the Galerkin
+  /// coarse-grid matrices I^T A_r I and I^T A_c I. The coarsest
+  /// level is solved with SuperLU. By default damped Jacobi (as in
+  /// ComplexDampedJacobi, with damping factor jacobi_damping_factor())
+  /// is used as the pre- and post-smoother on each level. The
+  /// preconditioner can be used with HelmholtzGMRESMG and
+  /// HelmholtzFGMRESMG.
+  //======================================================================
+  template<unsigned DIM>
+  class HelmholtzAMGPreconditioner : public BlockPreconditioner<CRDoubleMatrix>
+  {
+  public:
+    /// \short typedef for a function that returns a pointer to an object
+    /// of the class HelmholtzSmoother to be used as the pre-smoother
+    typedef HelmholtzSmoother* (*PreSmootherFactoryFctPt)();
+
+    /// \short typedef for a function that returns a pointer to an object
+    /// of the class HelmholtzSmoother to be used as the post-smoother
+    typedef HelmholtzSmoother* (*PostSmootherFactoryFctPt)();
+
+    /// \short Constructor: Pass the pointer to the problem whose Jacobian
+    /// is to be preconditioned and set up default values for the number
+    /// of V-cycles and pre- and post-smoothing steps, and the parameters
+    /// that control the coarsening.
+    HelmholtzAMGPreconditioner(Problem* problem_pt)
+      : BlockPreconditioner<CRDoubleMatrix>(),
+        Pre_smoother_factory_function_pt(0),
+        Post_smoother_factory_function_pt(0),
+        Problem_pt(problem_pt),
+        Coarsest_matrix_mg_pt(0),
+        Tolerance(1.0e-09),
+        Strength_threshold(0.25),
+        Max_coarsest_level_size(500),
+        Max_nlevel(10),
+        Nlevel(0),
+        Npre_smooth(2),
+        Npost_smooth(2),
+        Nvcycle(1),
+        V_cycle_counter(0),
+        Doc_time(true),
+        Suppress_v_cycle_output(false),
+        Alpha_shift(0.0),
+        Jacobi_damping_factor(0.5)
+    {
+    }
+
+    /// Delete any dynamically allocated data
+    ~HelmholtzAMGPreconditioner()
+    {
+      clean_up_memory();
+    }
+
+    /// Broken copy constructor
+    HelmholtzAMGPreconditioner(const HelmholtzAMGPreconditioner&)
+    {
+      BrokenCopy::broken_copy("HelmholtzAMGPreconditioner");
+    }
+
+    /// Broken assignment operator
+    void operator=(const HelmholtzAMGPreconditioner&)
+    {
+      BrokenCopy::broken_assign("HelmholtzAMGPreconditioner");
+    }
+
+    /// Access function to set the pre-smoother creation function.
+    void set_pre_smoother_factory_function(
+      PreSmootherFactoryFctPt pre_smoother_fn)
+    {
+      Pre_smoother_factory_function_pt = pre_smoother_fn;
+    }
+
+    /// Access function to set the post-smoother creation function.
+    void set_post_smoother_factory_function(
+      PostSmootherFactoryFctPt post_smoother_fn)
+    {
+      Post_smoother_factory_function_pt = post_smoother_fn;
+    }
+
+    /// Clean up anything that needs to be cleaned up
+    void clean_up_memory();
+
+    /// \short Access function for the variable Tolerance: the V-cycles
+    /// stop once the norm of the residual on the finest level has been
+    /// reduced by this factor (lvalue)
+    double& tolerance()
+    {
+      return Tolerance;
+    }
+
+    /// \short Access function for the complex shift, alpha, used to
+    /// build the complex-shifted Laplacian on the finest level (lvalue)
+    double& alpha_shift()
+    {
+      return Alpha_shift;
+    }
+
+    /// \short Threshold used to classify the coupling between unknowns i
+    /// and j as strong: |a_ij| >= threshold * sqrt(|a_ii a_jj|) (lvalue)
+    double& strength_threshold()
+    {
+      return Strength_threshold;
+    }
+
+    /// \short Coarsening stops once the number of (real) unknowns drops
+    /// below this value (lvalue)
+    unsigned& max_coarsest_level_size()
+    {
+      return Max_coarsest_level_size;
+    }
+
+    /// Maximum number of levels in the hierarchy (lvalue)
+    unsigned& max_nlevel()
+    {
+      return Max_nlevel;
+    }
+
+    /// Return the number of levels in the hierarchy
+    unsigned nlevel() const
+    {
+      return Nlevel;
+    }
+
+    /// \short Damping factor of the default (damped Jacobi) pre- and
+    /// post-smoothers; not used if smoother factory functions are
+    /// specified (lvalue)
+    double& jacobi_damping_factor()
+    {
+      return Jacobi_damping_factor;
+    }
+
+    /// Return the number of pre-smoothing iterations (lvalue)
+    unsigned& npre_smooth()
+    {
+      return Npre_smooth;
+    }
+
+    /// Return the number of post-smoothing iterations (lvalue)
+    unsigned& npost_smooth()
+    {
+      return Npost_smooth;
+    }
+
+    /// Return the number of V-cycles per preconditioner solve (lvalue)
+    unsigned& nvcycle()
+    {
+      return Nvcycle;
+    }
+
+    /// Number of iterations
+    unsigned iterations() const
+    {
+      return V_cycle_counter;
+    }
+
+    /// Enable time documentation
+    void enable_doc_time()
+    {
+      Doc_time = true;
+    }
+
+    /// Disable time documentation
+    void disable_doc_time()
+    {
+      Doc_time = false;
+    }
+
+    /// Enable the output of the V-cycle residuals
+    void enable_v_cycle_output()
+    {
+      Suppress_v_cycle_output = false;
+    }
+
+    /// Disable the output of the V-cycle residuals
+    void disable_v_cycle_output()
+    {
+      Suppress_v_cycle_output = true;
+    }
+
+    /// \short Set up the multigrid hierarchy for the matrix that has been
+    /// passed to the preconditioner
+    void setup();
+
+    /// \short Function applies the V-cycle(s) to the vector r
+    void preconditioner_solve(const DoubleVector& r, DoubleVector& z)
+    {
+      // Split up the RHS vector into the real and imaginary parts
+      this->get_block_vectors(r, Rhs_mg_vectors_storage[0]);
+
+      // Start from a zero initial guess
+      X_mg_vectors_storage[0][0].initialise(0.0);
+      X_mg_vectors_storage[0][1].initialise(0.0);
+
+      // Run the MG method
+      mg_solve();
+
+      // Copy the solution back into z
+      this->return_block_vectors(X_mg_vectors_storage[0], z);
+    }
+
+    /// \short Use the version in the Preconditioner base class for the
+    /// alternative setup function that takes a matrix pointer as an argument.
+    using Preconditioner::setup;
+
+  private:
+    /// \short Extract the real and imaginary parts of the (shifted)
+    /// Jacobian on the finest level
+    void setup_finest_level_matrices();
+
+    /// \short Group the unknowns on the level-th level into aggregates and
+    /// build the associated interpolation and restriction matrices.
+    /// Returns the number of aggregates (the size of the next level)
+    unsigned setup_transfer_matrices(const unsigned& level);
+
+    /// Set up the vectors associated with the level-th level
+    void setup_level_vectors(const unsigned& level);
+
+    /// Set up the pre- and post-smoothers on all but the coarsest level
+    void setup_smoothers();
+
+    /// \short Create the fully expanded (real) system matrix on the
+    /// coarsest level
+    void setup_coarsest_level_structures();
+
+    /// \short Compute the residual r=b-Ax on the level-th level, store it in
+    /// Residual_mg_vectors_storage and return its norm
+    double residual_norm(const unsigned& level);
+
+    /// \short Call the direct solver (SuperLU) to solve the problem on the
+    /// coarsest level exactly
+    void direct_solve();
+
+    /// \short Restrict the residual on the level-th level and store it in
+    /// the RHS vector on the next coarser level
+    void restrict_residual(const unsigned& level);
+
+    /// \short Interpolate the solution on the level-th level onto the next
+    /// finer level and correct the solution there
+    void interpolate_and_correct(const unsigned& level);
+
+    /// Perform the V-cycle(s)
+    void mg_solve();
+
+    /// Function to create pre-smoothers
+    PreSmootherFactoryFctPt Pre_smoother_factory_function_pt;
+
+    /// Function to create post-smoothers
+    PostSmootherFactoryFctPt Post_smoother_factory_function_pt;
+
+    /// Pointer to the problem whose Jacobian is preconditioned
+    Problem* Problem_pt;
+
+    /// \short Vector of vectors to store the real and imaginary parts of
+    /// the system matrix on each level
+    Vector<Vector<CRDoubleMatrix*>> Mg_matrices_storage_pt;
+
+    /// \short The fully expanded (real) system matrix on the coarsest level
+    CRDoubleMatrix* Coarsest_matrix_mg_pt;
+
+    /// Solution vector on the coarsest level
+    DoubleVector Coarsest_x_mg;
+
+    /// RHS vector on the coarsest level
+    DoubleVector Coarsest_rhs_mg;
+
+    /// Interpolation matrices from level i+1 to level i
+    Vector<CRDoubleMatrix*> Interpolation_matrices_storage_pt;
+
+    /// Restriction matrices from level i to level i+1
+    Vector<CRDoubleMatrix*> Restriction_matrices_storage_pt;
+
+    /// Real and imaginary parts of the solution vector on each level
+    Vector<Vector<DoubleVector>> X_mg_vectors_storage;
+
+    /// Real and imaginary parts of the RHS vector on each level
+    Vector<Vector<DoubleVector>> Rhs_mg_vectors_storage;
+
+    /// Real and imaginary parts of the residual vector on each level
+    Vector<Vector<DoubleVector>> Residual_mg_vectors_storage;
+
+    /// Pre-smoothers on each level
+    Vector<HelmholtzSmoother*> Pre_smoothers_storage_pt;
+
+    /// Post-smoothers on each level
+    Vector<HelmholtzSmoother*> Post_smoothers_storage_pt;
+
+    /// Tolerance for the V-cycles
+    double Tolerance;
+
+    /// Threshold for strong couplings
+    double Strength_threshold;
+
+    /// Coarsening stops once a level has fewer unknowns than this
+    unsigned Max_coarsest_level_size;
+
+    /// Maximum number of levels
+    unsigned Max_nlevel;
+
+    /// Number of levels in the hierarchy
+    unsigned Nlevel;
+
+    /// Number of pre-smoothing steps
+    unsigned Npre_smooth;
+
+    /// Number of post-smoothing steps
+    unsigned Npost_smooth;
+
+    /// Maximum number of V-cycles
+    unsigned Nvcycle;
+
+    /// The number of V-cycles performed in the last solve
+    unsigned V_cycle_counter;
+
+    /// Document the setup times?
+    bool Doc_time;
+
+    /// Suppress the output of the V-cycle residuals?
+    bool Suppress_v_cycle_output;
+
+    /// The complex shift used on the finest level
+    double Alpha_shift;
+
+    /// Damping factor of the default (damped Jacobi) smoothers
+    double Jacobi_damping_factor;
+  };
+
+
+  //===================================================================
+  /// Clean up all the dynamically allocated data
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::clean_up_memory()
+  {
+    unsigned n_level = Mg_matrices_storage_pt.size();
+    for (unsigned i = 0; i < n_level; i++)
+    {
+      for (unsigned j = 0; j < Mg_matrices_storage_pt[i].size(); j++)
+      {
+        delete Mg_matrices_storage_pt[i][j];
+      }
+    }
+    Mg_matrices_storage_pt.clear();
+
+    unsigned n_transfer = Interpolation_matrices_storage_pt.size();
+    for (unsigned i = 0; i < n_transfer; i++)
+    {
+      delete Interpolation_matrices_storage_pt[i];
+      delete Restriction_matrices_storage_pt[i];
+    }
+    Interpolation_matrices_storage_pt.clear();
+    Restriction_matrices_storage_pt.clear();
+
+    unsigned n_smoother = Pre_smoothers_storage_pt.size();
+    for (unsigned i = 0; i < n_smoother; i++)
+    {
+      delete Pre_smoothers_storage_pt[i];
+      delete Post_smoothers_storage_pt[i];
+    }
+    Pre_smoothers_storage_pt.clear();
+    Post_smoothers_storage_pt.clear();
+
+    delete Coarsest_matrix_mg_pt;
+    Coarsest_matrix_mg_pt = 0;
+
+    X_mg_vectors_storage.clear();
+    Rhs_mg_vectors_storage.clear();
+    Residual_mg_vectors_storage.clear();
+
+    Nlevel = 0;
+  } // End of clean_up_memory
+
+
+  //===================================================================
+  /// Set up the multigrid hierarchy
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::setup()
+  {
+#ifdef OOMPH_HAS_MPI
+    // Make sure that this is running in serial. Can't guarantee it'll
+    // work when the problem is distributed over several processors
+    if (MPI_Helpers::communicator_pt()->nproc() > 1)
+    {
+      OomphLibWarning("Can't guarantee the AMG solver will work in parallel!",
+                      OOMPH_CURRENT_FUNCTION,
+                      OOMPH_EXCEPTION_LOCATION);
+    }
+#endif
+
+    double t_start = TimingHelpers::timer();
+
+    // Wipe any previous hierarchy
+    clean_up_memory();
+
+    // Get the real and imaginary parts of the system matrix on the
+    // finest level
+    Mg_matrices_storage_pt.resize(1);
+    setup_finest_level_matrices();
+    setup_level_vectors(0);
+
+    // Coarsen until the matrices are small enough (or the coarsening
+    // stagnates)
+    unsigned level = 0;
+    while (level + 1 < Max_nlevel)
+    {
+      unsigned n_fine = Mg_matrices_storage_pt[level][0]->nrow();
+      if (n_fine <= Max_coarsest_level_size)
+      {
+        break;
+      }
+
+      // Build the aggregates and the transfer matrices
+      unsigned n_coarse = setup_transfer_matrices(level);
+
+      // Give up if the coarsening is ineffective
+      if (n_coarse == 0 || 10 * n_coarse > 9 * n_fine)
+      {
+        delete Interpolation_matrices_storage_pt.back();
+        Interpolation_matrices_storage_pt.pop_back();
+        delete Restriction_matrices_storage_pt.back();
+        Restriction_matrices_storage_pt.pop_back();
+        break;
+      }
+
+      // Galerkin approximation of the real and imaginary parts of the
+      // system matrix on the coarser level: I^T A I
+      Mg_matrices_storage_pt.resize(level + 2);
+      Mg_matrices_storage_pt[level + 1].resize(2, 0);
+      for (unsigned j = 0; j < 2; j++)
+      {
+        CRDoubleMatrix a_times_interpolation;
+        Mg_matrices_storage_pt[level][j]->multiply(
+          *Interpolation_matrices_storage_pt[level], a_times_interpolation);
+        Mg_matrices_storage_pt[level + 1][j] = new CRDoubleMatrix;
+        Restriction_matrices_storage_pt[level]->multiply(
+          a_times_interpolation, *Mg_matrices_storage_pt[level + 1][j]);
+      }
+
+      level++;
+      setup_level_vectors(level);
+    }
+    Nlevel = level + 1;
+
+    // Set up the smoothers and the coarsest level solver
+    setup_smoothers();
+    setup_coarsest_level_structures();
+
+    if (Doc_time)
+    {
+      oomph_info << "Helmholtz AMG hierarchy with " << Nlevel
+                 << " levels; unknowns per level:";
+      for (unsigned i = 0; i < Nlevel; i++)
+      {
+        oomph_info << " " << 2 * Mg_matrices_storage_pt[i][0]->nrow();
+      }
+      oomph_info << "\nCPU time for setup of Helmholtz AMG [sec]: "
+                 << TimingHelpers::timer() - t_start << std::endl;
+    }
+  } // End of setup
+
+
+  //===================================================================
+  /// Extract the real and imaginary parts of the (shifted) Jacobian
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::setup_finest_level_matrices()
+  {
+    // The preconditioner works with one mesh; set it! Elements in the
+    // PML layer are trivially wrapped versions of their bulk counterparts
+    // so we have to allow different element types
+    this->set_nmesh(1);
+    bool allow_different_element_types_in_mesh = true;
+    this->set_mesh(
+      0, Problem_pt->mesh_pt(), allow_different_element_types_in_mesh);
+
+#ifdef PARANOID
+    // This preconditioner only works for 2 dof types
+    if (this->ndof_types() != 2)
+    {
+      std::stringstream tmp;
+      tmp << "This preconditioner only works for problems with 2 dof types\n"
+          << "Yours has " << this->ndof_types();
+      throw OomphLibError(
+        tmp.str(), OOMPH_CURRENT_FUNCTION, OOMPH_EXCEPTION_LOCATION);
+    }
+#endif
+
+    Mg_matrices_storage_pt[0].resize(2, 0);
+    for (unsigned j = 0; j < 2; j++)
+    {
+      Mg_matrices_storage_pt[0][j] = new CRDoubleMatrix;
+    }
+
+    // Without a shift, we use the original Jacobian
+    if (Alpha_shift == 0.0)
+    {
+      this->block_setup();
+      for (unsigned i_row = 0; i_row < 2; i_row++)
+      {
+        this->get_block(i_row, 0, *Mg_matrices_storage_pt[0][i_row]);
+      }
+      return;
+    }
+
+    // Otherwise set the damping in all of the PML elements to create the
+    // complex-shifted Laplacian
+    Mesh* mesh_pt = Problem_pt->mesh_pt();
+    unsigned n_element = mesh_pt->nelement();
+    double alpha_shift = Alpha_shift;
+    Vector<double*> original_alpha_pt(n_element, 0);
+    for (unsigned e = 0; e < n_element; e++)
+    {
+      PMLHelmholtzEquations<DIM>* el_pt =
+        dynamic_cast<PMLHelmholtzEquations<DIM>*>(mesh_pt->element_pt(e));
+      if (el_pt != 0)
+      {
+        original_alpha_pt[e] = el_pt->alpha_pt();
+        el_pt->alpha_pt() = &alpha_shift;
+      }
+    }
+
+    // Compute the shifted Jacobian and extract its blocks (the original
+    // Jacobian is reinstated afterwards so that the linear solver isn't
+    // affected)
+    CRDoubleMatrix* jacobian_pt = this->matrix_pt();
+    CRDoubleMatrix* shifted_jacobian_pt = new CRDoubleMatrix;
+    DoubleVector residuals;
+    Problem_pt->get_jacobian(residuals, *shifted_jacobian_pt);
+    this->set_matrix_pt(shifted_jacobian_pt);
+    this->block_setup();
+    for (unsigned i_row = 0; i_row < 2; i_row++)
+    {
+      this->get_block(i_row, 0, *Mg_matrices_storage_pt[0][i_row]);
+    }
+    delete shifted_jacobian_pt;
+    this->set_matrix_pt(jacobian_pt);
+
+    // Reset the damping in the PML elements
+    for (unsigned e = 0; e < n_element; e++)
+    {
+      if (original_alpha_pt[e] != 0)
+      {
+        dynamic_cast<PMLHelmholtzEquations<DIM>*>(mesh_pt->element_pt(e))
+          ->alpha_pt() = original_alpha_pt[e];
+      }
+    }
+  } // End of setup_finest_level_matrices
+
+
+  //===================================================================
+  /// Group the unknowns on the level-th level into aggregates of
+  /// strongly coupled unknowns and build the (piecewise constant)
+  /// interpolation matrix and its transpose, the restriction matrix.
+  /// Returns the number of aggregates.
+  //===================================================================
+  template<unsigned DIM>
+  unsigned HelmholtzAMGPreconditioner<DIM>::setup_transfer_matrices(
+    const unsigned& level)
+  {
+    // The aggregation is based on the real part of the matrix
+    CRDoubleMatrix* matrix_pt = Mg_matrices_storage_pt[level][0];
+    unsigned n_row = matrix_pt->nrow();
+    const int* row_start = matrix_pt->row_start();
+    const int* column_index = matrix_pt->column_index();
+    const double* value = matrix_pt->value();
+
+    // Magnitude of the diagonal entries
+    Vector<double> diagonal(n_row, 0.0);
+    for (unsigned i = 0; i < n_row; i++)
+    {
+      for (int k = row_start[i]; k < row_start[i + 1]; k++)
+      {
+        if (unsigned(column_index[k]) == i)
+        {
+          diagonal[i] = std::fabs(value[k]);
+        }
+      }
+    }
+
+    // Flag the strong off-diagonal couplings
+    std::vector<bool> is_strong(row_start[n_row], false);
+    for (unsigned i = 0; i < n_row; i++)
+    {
+      for (int k = row_start[i]; k < row_start[i + 1]; k++)
+      {
+        unsigned j = column_index[k];
+        is_strong[k] =
+          (j != i) && (value[k] != 0.0) &&
+          (std::fabs(value[k]) >=
+           Strength_threshold * std::sqrt(diagonal[i] * diagonal[j]));
+      }
+    }
+
+    // Aggregate of each unknown (-1 if it hasn't been aggregated yet)
+    Vector<int> aggregate(n_row, -1);
+    int n_aggregate = 0;
+
+    // Pass 1: Unknowns whose strongly coupled neighbours are all still
+    // unaggregated form a new aggregate with these neighbours
+    for (unsigned i = 0; i < n_row; i++)
+    {
+      if (aggregate[i] != -1) continue;
+      bool neighbourhood_is_free = true;
+      for (int k = row_start[i]; k < row_start[i + 1]; k++)
+      {
+        if (is_strong[k] && (aggregate[column_index[k]] != -1))
+        {
+          neighbourhood_is_free = false;
+          break;
+        }
+      }
+      if (neighbourhood_is_free)
+      {
+        aggregate[i] = n_aggregate;
+        for (int k = row_start[i]; k < row_start[i + 1]; k++)
+        {
+          if (is_strong[k])
+          {
+            aggregate[column_index[k]] = n_aggregate;
+          }
+        }
+        n_aggregate++;
+      }
+    }
+
+    // Pass 2: Add the remaining unknowns to the aggregate (from pass 1)
+    // of their most strongly coupled neighbour
+    Vector<int> aggregate_after_first_pass(aggregate);
+    for (unsigned i = 0; i < n_row; i++)
+    {
+      if (aggregate[i] != -1) continue;
+      double max_coupling = 0.0;
+      for (int k = row_start[i]; k < row_start[i + 1]; k++)
+      {
+        int neighbour_aggregate = aggregate_after_first_pass[column_index[k]];
+        if (is_strong[k] && (neighbour_aggregate != -1) &&
+            (std::fabs(value[k]) > max_coupling))
+        {
+          max_coupling = std::fabs(value[k]);
+          aggregate[i] = neighbour_aggregate;
+        }
+      }
+    }
+
+    // Pass 3: Any unknowns that are still left over form aggregates with
+    // their unaggregated strongly coupled neighbours
+    for (unsigned i = 0; i < n_row; i++)
+    {
+      if (aggregate[i] != -1) continue;
+      aggregate[i] = n_aggregate;
+      for (int k = row_start[i]; k < row_start[i + 1]; k++)
+      {
+        if (is_strong[k] && (aggregate[column_index[k]] == -1))
+        {
+          aggregate[column_index[k]] = n_aggregate;
+        }
+      }
+      n_aggregate++;
+    }
+
+    // Build the piecewise constant interpolation matrix: Each fine
+    // unknown takes the value of its aggregate
+    Vector<double> interpolation_value(n_row, 1.0);
+    Vector<int> interpolation_column_index(n_row);
+    Vector<int> interpolation_row_start(n_row + 1);
+    for (unsigned i = 0; i < n_row; i++)
+    {
+      interpolation_column_index[i] = aggregate[i];
+      interpolation_row_start[i] = i;
+    }
+    interpolation_row_start[n_row] = n_row;
+
+    CRDoubleMatrix* interpolation_pt = new CRDoubleMatrix;
+    interpolation_pt->build(matrix_pt->distribution_pt(),
+                            n_aggregate,
+                            interpolation_value,
+                            interpolation_column_index,
+                            interpolation_row_start);
+    Interpolation_matrices_storage_pt.push_back(interpolation_pt);
+
+    // The restriction is the transpose of the interpolation
+    CRDoubleMatrix* restriction_pt = new CRDoubleMatrix;
+    interpolation_pt->get_matrix_transpose(restriction_pt);
+    Restriction_matrices_storage_pt.push_back(restriction_pt);
+
+    return n_aggregate;
+  } // End of setup_transfer_matrices
+
+
+  //===================================================================
+  /// Set up the vectors associated with the level-th level
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::setup_level_vectors(
+    const unsigned& level)
+  {
+    LinearAlgebraDistribution* dist_pt =
+      Mg_matrices_storage_pt[level][0]->distribution_pt();
+
+    X_mg_vectors_storage.resize(level + 1);
+    Rhs_mg_vectors_storage.resize(level + 1);
+    Residual_mg_vectors_storage.resize(level + 1);
+    X_mg_vectors_storage[level].resize(2);
+    Rhs_mg_vectors_storage[level].resize(2);
+    Residual_mg_vectors_storage[level].resize(2);
+    for (unsigned j = 0; j < 2; j++)
+    {
+      X_mg_vectors_storage[level][j].build(dist_pt, 0.0);
+      Rhs_mg_vectors_storage[level][j].build(dist_pt, 0.0);
+      Residual_mg_vectors_storage[level][j].build(dist_pt, 0.0);
+    }
+  } // End of setup_level_vectors
+
+
+  //===================================================================
+  /// Set up the pre- and post-smoothers on all but the coarsest level
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::setup_smoothers()
+  {
+    Pre_smoothers_storage_pt.resize(Nlevel - 1, 0);
+    Post_smoothers_storage_pt.resize(Nlevel - 1, 0);
+    for (unsigned i = 0; i < Nlevel - 1; i++)
+    {
+      // Create the smoothers (damped Jacobi by default)
+      if (0 == Pre_smoother_factory_function_pt)
+      {
+        Pre_smoothers_storage_pt[i] =
+          new ComplexDampedJacobi<CRDoubleMatrix>(Jacobi_damping_factor);
+      }
+      else
+      {
+        Pre_smoothers_storage_pt[i] = (*Pre_smoother_factory_function_pt)();
+      }
+      if (0 == Post_smoother_factory_function_pt)
+      {
+        Post_smoothers_storage_pt[i] =
+          new ComplexDampedJacobi<CRDoubleMatrix>(Jacobi_damping_factor);
+      }
+      else
+      {
+        Post_smoothers_storage_pt[i] = (*Post_smoother_factory_function_pt)();
+      }
+
+      // Make sure the smoothers perform the prescribed number of
+      // iterations (the norm which is compared against the tolerance is
+      // calculated differently to the multigrid solver)
+      Pre_smoothers_storage_pt[i]->tolerance() = 1.0e-16;
+      Post_smoothers_storage_pt[i]->tolerance() = 1.0e-16;
+      Pre_smoothers_storage_pt[i]->max_iter() = Npre_smooth;
+      Post_smoothers_storage_pt[i]->max_iter() = Npost_smooth;
+
+      // Pass the system matrix on the i-th level to the smoothers
+      Pre_smoothers_storage_pt[i]->complex_smoother_setup(
+        Mg_matrices_storage_pt[i]);
+      Post_smoothers_storage_pt[i]->complex_smoother_setup(
+        Mg_matrices_storage_pt[i]);
+
+      // Set up their distributions
+      LinearAlgebraDistribution* dist_pt =
+        Mg_matrices_storage_pt[i][0]->distribution_pt();
+      Pre_smoothers_storage_pt[i]->build_distribution(dist_pt);
+      Post_smoothers_storage_pt[i]->build_distribution(dist_pt);
+
+      if (!Doc_time)
+      {
+        Pre_smoothers_storage_pt[i]->disable_doc_time();
+        Post_smoothers_storage_pt[i]->disable_doc_time();
+      }
+    }
+  } // End of setup_smoothers
+
+
+  //===================================================================
+  /// Create the fully expanded system matrix on the coarsest level:
+  ///                       |-----|------|
+  ///                       | A_r | -A_c |
+  /// Coarse_matrix_mg_pt = |-----|------|
+  ///                       | A_c |  A_r |
+  ///                       |-----|------|
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::setup_coarsest_level_structures()
+  {
+    CRDoubleMatrix* real_matrix_pt = Mg_matrices_storage_pt[Nlevel - 1][0];
+    CRDoubleMatrix* imag_matrix_pt = Mg_matrices_storage_pt[Nlevel - 1][1];
+    int n_row = real_matrix_pt->nrow();
+
+    // Pointers to the real and imaginary parts: In the first block row
+    // we have [A_r -A_c], in the second one [A_c A_r]
+    const int* row_start_pt[2] = {real_matrix_pt->row_start(),
+                                  imag_matrix_pt->row_start()};
+    const int* column_index_pt[2] = {real_matrix_pt->column_index(),
+                                     imag_matrix_pt->column_index()};
+    const double* value_pt[2] = {real_matrix_pt->value(),
+                                 imag_matrix_pt->value()};
+    unsigned nnz = 2 * (real_matrix_pt->nnz() + imag_matrix_pt->nnz());
+
+    Vector<double> value;
+    Vector<int> column_index;
+    Vector<int> row_start(2 * n_row + 1, 0);
+    value.reserve(nnz);
+    column_index.reserve(nnz);
+    for (unsigned block_row = 0; block_row < 2; block_row++)
+    {
+      for (int i = 0; i < n_row; i++)
+      {
+        for (unsigned block_col = 0; block_col < 2; block_col++)
+        {
+          // Real part on the diagonal blocks, imaginary part off it
+          unsigned part = (block_row == block_col) ? 0 : 1;
+          double sign = (block_row == 0 && block_col == 1) ? -1.0 : 1.0;
+          for (int k = row_start_pt[part][i]; k < row_start_pt[part][i + 1];
+               k++)
+          {
+            column_index.push_back(column_index_pt[part][k] +
+                                   block_col * n_row);
+            value.push_back(sign * value_pt[part][k]);
+          }
+        }
+        row_start[block_row * n_row + i + 1] = value.size();
+      }
+    }
+
+    LinearAlgebraDistribution dist(
+      real_matrix_pt->distribution_pt()->communicator_pt(), 2 * n_row, false);
+    Coarsest_matrix_mg_pt = new CRDoubleMatrix;
+    Coarsest_matrix_mg_pt->build(
+      &dist, 2 * n_row, value, column_index, row_start);
+    if (!Doc_time)
+    {
+      Coarsest_matrix_mg_pt->linear_solver_pt()->disable_doc_time();
+    }
+
+    Coarsest_x_mg.build(&dist, 0.0);
+    Coarsest_rhs_mg.build(&dist, 0.0);
+  } // End of setup_coarsest_level_structures
+
+
+  //===================================================================
+  /// Compute the residual r=b-Ax on the level-th level and return
+  /// its norm
+  //===================================================================
+  template<unsigned DIM>
+  double HelmholtzAMGPreconditioner<DIM>::residual_norm(const unsigned& level)
+  {
+    Vector<DoubleVector>& residual = Residual_mg_vectors_storage[level];
+
+    // Compute A*x (in a single sweep over both matrices)...
+    ComplexSmootherHelpers::complex_matrix_multiplication(
+      Mg_matrices_storage_pt[level], X_mg_vectors_storage[level], residual);
+
+    // ...and subtract it from b
+    double norm_squared = 0.0;
+    for (unsigned j = 0; j < 2; j++)
+    {
+      double* r_pt = residual[j].values_pt();
+      const double* b_pt = Rhs_mg_vectors_storage[level][j].values_pt();
+      unsigned n_row = residual[j].nrow_local();
+      for (unsigned i = 0; i < n_row; i++)
+      {
+        r_pt[i] = b_pt[i] - r_pt[i];
+        norm_squared += r_pt[i] * r_pt[i];
+      }
+    }
+    return std::sqrt(norm_squared);
+  } // End of residual_norm
+
+
+  //===================================================================
+  /// Solve the problem on the coarsest level exactly
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::direct_solve()
+  {
+    DoubleVectorHelpers::concatenate(Rhs_mg_vectors_storage[Nlevel - 1],
+                                     Coarsest_rhs_mg);
+    Coarsest_matrix_mg_pt->solve(Coarsest_rhs_mg, Coarsest_x_mg);
+    DoubleVectorHelpers::split(Coarsest_x_mg, X_mg_vectors_storage[Nlevel - 1]);
+  } // End of direct_solve
+
+
+  //===================================================================
+  /// Restrict the residual on the level-th level to the next coarser
+  /// level and store it in the RHS vector there
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::restrict_residual(
+    const unsigned& level)
+  {
+    for (unsigned j = 0; j < 2; j++)
+    {
+      Restriction_matrices_storage_pt[level]->multiply(
+        Residual_mg_vectors_storage[level][j],
+        Rhs_mg_vectors_storage[level + 1][j]);
+    }
+  } // End of restrict_residual
+
+
+  //===================================================================
+  /// Interpolate the solution on the level-th level onto the next
+  /// finer level and correct the solution there
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::interpolate_and_correct(
+    const unsigned& level)
+  {
+    // The interpolation is piecewise constant, so each fine unknown is
+    // simply corrected by the value of its aggregate
+    CRDoubleMatrix* interpolation_pt =
+      Interpolation_matrices_storage_pt[level - 1];
+    const int* column_index = interpolation_pt->column_index();
+    const int* row_start = interpolation_pt->row_start();
+    const double* value = interpolation_pt->value();
+    unsigned n_row = interpolation_pt->nrow();
+    for (unsigned j = 0; j < 2; j++)
+    {
+      double* x_fine_pt = X_mg_vectors_storage[level - 1][j].values_pt();
+      const double* x_coarse_pt = X_mg_vectors_storage[level][j].values_pt();
+      for (unsigned i = 0; i < n_row; i++)
+      {
+        for (int k = row_start[i]; k < row_start[i + 1]; k++)
+        {
+          x_fine_pt[i] += value[k] * x_coarse_pt[column_index[k]];
+        }
+      }
+    }
+  } // End of interpolate_and_correct
+
+
+  //===================================================================
+  /// Perform the V-cycle(s) for the RHS stored on the finest level,
+  /// starting from the solution stored there
+  //===================================================================
+  template<unsigned DIM>
+  void HelmholtzAMGPreconditioner<DIM>::mg_solve()
+  {
+    V_cycle_counter = 0;
+
+    // Only one level: solve directly
+    if (Nlevel == 1)
+    {
+      direct_solve();
+      V_cycle_counter = 1;
+      return;
+    }
+
+    // The V-cycles are stopped once the residual has been reduced by
+    // the factor Tolerance (there's nothing to do for a zero residual)
+    const double initial_residual_norm = residual_norm(0);
+    if (initial_residual_norm == 0.0)
+    {
+      return;
+    }
+    double normalised_residual_norm = 1.0;
+    while ((normalised_residual_norm > Tolerance) &&
+           (V_cycle_counter != Nvcycle))
+    {
+      // Downward sweep
+      for (unsigned i = 0; i < Nlevel - 1; i++)
+      {
+        // Start from a zero correction on the coarser levels
+        if (i != 0)
+        {
+          X_mg_vectors_storage[i][0].initialise(0.0);
+          X_mg_vectors_storage[i][1].initialise(0.0);
+        }
+
+        // Pre-smooth, then restrict the residual
+        Pre_smoothers_storage_pt[i]->complex_smoother_solve(
+          Rhs_mg_vectors_storage[i], X_mg_vectors_storage[i]);
+        residual_norm(i);
+        restrict_residual(i);
+      }
+
+      // Solve on the coarsest level
+      direct_solve();
+
+      // Upward sweep: Correct and post-smooth
+      for (unsigned i = Nlevel - 1; i > 0; i--)
+      {
+        interpolate_and_correct(i);
+        Post_smoothers_storage_pt[i - 1]->complex_smoother_solve(
+          Rhs_mg_vectors_storage[i - 1], X_mg_vectors_storage[i - 1]);
+      }
+
+      V_cycle_counter++;
+      normalised_residual_norm = residual_norm(0) / initial_residual_norm;
+
+      if (!Suppress_v_cycle_output)
+      {
+        oomph_info << "Normalised residual on finest level after V-cycle "
+                   << V_cycle_counter << ": " << normalised_residual_norm
+                   << std::endl;
+      }
+    }
+  } // End of mg_solve
+
+} // End of namespace oomph
+
+#endif
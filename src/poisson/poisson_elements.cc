@@ -67,6 +67,10 @@ namespace oomph
     // Integers to store the local equation and unknown numbers
     int local_eqn = 0, local_unknown = 0;
 
+    // Storage for the position (passed to the source function); allocated
+    // once rather than at every integration point
+    Vector<double> interpolated_x(DIM);
+
     // Loop over the integration points
     for (unsigned ipt = 0; ipt < n_intpt; ipt++)
     {
@@ -81,10 +85,15 @@ namespace oomph
       double W = w * J;
 
       // Calculate local values of unknown
-      // Allocate and initialise to zero
+      // Initialise to zero; DIM is known at compile time so the
+      // derivatives live on the stack
       double interpolated_u = 0.0;
-      Vector<double> interpolated_x(DIM, 0.0);
-      Vector<double> interpolated_dudx(DIM, 0.0);
+      double interpolated_dudx[DIM];
+      for (unsigned j = 0; j < DIM; j++)
+      {
+        interpolated_x[j] = 0.0;
+        interpolated_dudx[j] = 0.0;
+      }
 
       // Calculate function value and derivatives:
       //-----------------------------------------
@@ -140,11 +149,12 @@ namespace oomph
               if (local_unknown >= 0)
               {
                 // Add contribution to Elemental Matrix
+                double sum = 0.0;
                 for (unsigned i = 0; i < DIM; i++)
                 {
-                  jacobian(local_eqn, local_unknown) +=
-                    dpsidx(l2, i) * dtestdx(l, i) * W;
+                  sum += dpsidx(l2, i) * dtestdx(l, i);
                 }
+                jacobian(local_eqn, local_unknown) += sum * W;
               }
             }
           }
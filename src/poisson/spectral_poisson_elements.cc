@@ -35,6 +35,395 @@ namespace oomph
   template<unsigned DIM, unsigned NNODE_1D>
   const unsigned QSpectralPoissonElement<DIM, NNODE_1D>::Initial_Nvalue = 1;
 
+
+  //======================================================================
+  /// The sum-factorised kernels require the default (Gauss-Lobatto-
+  /// Legendre) integration scheme, whose knots are the tensor product of
+  /// the one-dimensional knots used in SumFactorisation, and
+  /// no hanging nodes.
+  //======================================================================
+  template<unsigned DIM, unsigned NNODE_1D>
+  bool QSpectralPoissonElement<DIM, NNODE_1D>::sum_factorisation_is_applicable()
+    const
+  {
+    if (dynamic_cast<GaussLobattoLegendre<DIM, NNODE_1D>*>(
+          this->integral_pt()) == 0)
+    {
+      return false;
+    }
+
+    const int u_nodal_index = this->u_index_poisson();
+    const unsigned n_node = this->nnode();
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      if (this->node_pt(l)->is_hanging(-1) ||
+          this->node_pt(l)->is_hanging(u_nodal_index))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+
+  //======================================================================
+  /// Get the geometric factors at the knots of the default integration
+  /// scheme by interpolating the derivatives of the nodal positions
+  /// direction by direction.
+  //======================================================================
+  template<unsigned DIM, unsigned NNODE_1D>
+  void QSpectralPoissonElement<DIM, NNODE_1D>::
+    get_geometric_factors_by_sum_factorisation(double* const& g,
+                                               double* const& W) const
+  {
+    const unsigned n_node = SumFactorisation::Nnode;
+    const unsigned n_knot = SumFactorisation::Nknot;
+
+    // One-dimensional matrices to apply in each coordinate direction to
+    // differentiate w.r.t. the i-th local coordinate
+    const double* a_derivative[DIM][DIM];
+    for (unsigned i = 0; i < DIM; i++)
+    {
+      for (unsigned d = 0; d < DIM; d++)
+      {
+        a_derivative[i][d] = (d == i) ? &SumFactorisation::Dpsi[0] :
+                                        &SumFactorisation::Psi[0];
+      }
+    }
+
+    // Derivatives of the global coordinates w.r.t. the local ones at the
+    // knots: dxds[(DIM*i+j)*n_knot+ipt] = dx_j/ds_i
+    double x_nodal[SumFactorisation::Nnode];
+    double dxds[DIM * DIM * SumFactorisation::Nknot];
+    for (unsigned j = 0; j < DIM; j++)
+    {
+      for (unsigned l = 0; l < n_node; l++)
+      {
+        x_nodal[l] = this->raw_nodal_position(l, j);
+      }
+      for (unsigned i = 0; i < DIM; i++)
+      {
+        SumFactorisation::interpolate_to_knots(
+          a_derivative[i], x_nodal, &dxds[(DIM * i + j) * n_knot]);
+      }
+    }
+
+    // Invert the Jacobian of the mapping at each knot
+    DenseMatrix<double> jacobian(DIM), inverse_jacobian(DIM);
+    for (unsigned ipt = 0; ipt < n_knot; ipt++)
+    {
+      for (unsigned i = 0; i < DIM; i++)
+      {
+        for (unsigned j = 0; j < DIM; j++)
+        {
+          jacobian(i, j) = dxds[(DIM * i + j) * n_knot + ipt];
+        }
+      }
+      const double J =
+        this->invert_jacobian_mapping(jacobian, inverse_jacobian);
+      W[ipt] = this->integral_pt()->weight(ipt) * J;
+
+      // ds_i/dx_k = inverse_jacobian(k,i)
+      for (unsigned i = 0; i < DIM; i++)
+      {
+        for (unsigned j = 0; j < DIM; j++)
+        {
+          double sum = 0.0;
+          for (unsigned k = 0; k < DIM; k++)
+          {
+            sum += inverse_jacobian(k, i) * inverse_jacobian(k, j);
+          }
+          g[(DIM * i + j) * n_knot + ipt] = W[ipt] * sum;
+        }
+      }
+    }
+  }
+
+
+  //======================================================================
+  /// Add the discrete Laplace operator applied to the nodal values to
+  /// result_nodal: interpolate the local derivatives to the knots,
+  /// contract them with the geometric factors and integrate against the
+  /// local derivatives of the test functions.
+  //======================================================================
+  template<unsigned DIM, unsigned NNODE_1D>
+  void QSpectralPoissonElement<DIM, NNODE_1D>::
+    add_laplace_operator_by_sum_factorisation(
+      const double* const& g,
+      const double* const& u_nodal,
+      double* const& result_nodal) const
+  {
+    const unsigned n_knot = SumFactorisation::Nknot;
+
+    const double* a_derivative[DIM][DIM];
+    for (unsigned i = 0; i < DIM; i++)
+    {
+      for (unsigned d = 0; d < DIM; d++)
+      {
+        a_derivative[i][d] = (d == i) ? &SumFactorisation::Dpsi[0] :
+                                        &SumFactorisation::Psi[0];
+      }
+    }
+
+    // Local derivatives of u at the knots
+    double duds[DIM][SumFactorisation::Nknot];
+    for (unsigned i = 0; i < DIM; i++)
+    {
+      SumFactorisation::interpolate_to_knots(a_derivative[i], u_nodal, duds[i]);
+    }
+
+    // Contract with the geometric factors and integrate
+    double flux[SumFactorisation::Nknot];
+    for (unsigned j = 0; j < DIM; j++)
+    {
+      for (unsigned ipt = 0; ipt < n_knot; ipt++)
+      {
+        double sum = 0.0;
+        for (unsigned i = 0; i < DIM; i++)
+        {
+          sum += g[(DIM * i + j) * n_knot + ipt] * duds[i][ipt];
+        }
+        flux[ipt] = sum;
+      }
+      SumFactorisation::add_integral_over_knots(
+        a_derivative[j], flux, result_nodal);
+    }
+  }
+
+
+  //======================================================================
+  /// Add the element's contribution to its residual vector. If enabled
+  /// and applicable, this is computed by sum factorisation, at a cost of
+  /// O(NNODE_1D^(DIM+1)) rather than O(NNODE_1D^(2 DIM)) operations; the
+  /// result is the same as that of the generic version in
+  /// PoissonEquations<DIM>.
+  //======================================================================
+  template<unsigned DIM, unsigned NNODE_1D>
+  void QSpectralPoissonElement<DIM, NNODE_1D>::
+    fill_in_contribution_to_residuals(Vector<double>& residuals)
+  {
+    if (!(Use_sum_factorisation && sum_factorisation_is_applicable()))
+    {
+      PoissonEquations<DIM>::fill_in_contribution_to_residuals(residuals);
+      return;
+    }
+
+    const unsigned n_node = SumFactorisation::Nnode;
+    const unsigned n_knot = SumFactorisation::Nknot;
+    const unsigned u_nodal_index = this->u_index_poisson();
+
+    // Geometric factors and weights at the knots
+    double g[DIM * DIM * SumFactorisation::Nknot];
+    double W[SumFactorisation::Nknot];
+    get_geometric_factors_by_sum_factorisation(g, W);
+
+    // The Poisson bit itself
+    double u_nodal[SumFactorisation::Nnode];
+    double residuals_nodal[SumFactorisation::Nnode];
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      u_nodal[l] = this->raw_nodal_value(l, u_nodal_index);
+      residuals_nodal[l] = 0.0;
+    }
+    add_laplace_operator_by_sum_factorisation(g, u_nodal, residuals_nodal);
+
+    // Interpolate the position to the knots (for the source function)
+    const double* a_interpolate[DIM];
+    for (unsigned d = 0; d < DIM; d++)
+    {
+      a_interpolate[d] = &SumFactorisation::Psi[0];
+    }
+    double x_nodal[SumFactorisation::Nnode];
+    double x_knot[DIM][SumFactorisation::Nknot];
+    for (unsigned j = 0; j < DIM; j++)
+    {
+      for (unsigned l = 0; l < n_node; l++)
+      {
+        x_nodal[l] = this->raw_nodal_position(l, j);
+      }
+      SumFactorisation::interpolate_to_knots(a_interpolate, x_nodal, x_knot[j]);
+    }
+
+    // Body force/source term
+    double source_knot[SumFactorisation::Nknot];
+    Vector<double> interpolated_x(DIM);
+    for (unsigned ipt = 0; ipt < n_knot; ipt++)
+    {
+      for (unsigned j = 0; j < DIM; j++)
+      {
+        interpolated_x[j] = x_knot[j][ipt];
+      }
+      double source;
+      this->get_source_poisson(ipt, interpolated_x, source);
+      source_knot[ipt] = source * W[ipt];
+    }
+    SumFactorisation::add_integral_over_knots(
+      a_interpolate, source_knot, residuals_nodal);
+
+    // Add to the residuals
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      const int local_eqn = this->nodal_local_eqn(l, u_nodal_index);
+      if (local_eqn >= 0)
+      {
+        residuals[local_eqn] += residuals_nodal[l];
+      }
+    }
+  }
+
+
+  //======================================================================
+  /// Compute the product of the element's Jacobian matrix with the
+  /// vector x (indexed by the local equation numbers) without assembling
+  /// the matrix.
+  //======================================================================
+  template<unsigned DIM, unsigned NNODE_1D>
+  void QSpectralPoissonElement<DIM, NNODE_1D>::get_jacobian_vector_product(
+    const Vector<double>& x, Vector<double>& product)
+  {
+    const unsigned n_dof = this->ndof();
+    product.assign(n_dof, 0.0);
+
+    // Multiply by the elemental Jacobian matrix if we can't use sum
+    // factorisation
+    if (!sum_factorisation_is_applicable())
+    {
+      Vector<double> residuals(n_dof);
+      DenseMatrix<double> jacobian(n_dof);
+      this->get_jacobian(residuals, jacobian);
+      for (unsigned i = 0; i < n_dof; i++)
+      {
+        for (unsigned j = 0; j < n_dof; j++)
+        {
+          product[i] += jacobian(i, j) * x[j];
+        }
+      }
+      return;
+    }
+
+    const unsigned n_node = SumFactorisation::Nnode;
+    const unsigned u_nodal_index = this->u_index_poisson();
+
+    double g[DIM * DIM * SumFactorisation::Nknot];
+    double W[SumFactorisation::Nknot];
+    get_geometric_factors_by_sum_factorisation(g, W);
+
+    // Gather x at the nodes (pinned values don't contribute)
+    double x_nodal[SumFactorisation::Nnode];
+    double product_nodal[SumFactorisation::Nnode];
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      const int local_unknown = this->nodal_local_eqn(l, u_nodal_index);
+      x_nodal[l] = (local_unknown >= 0) ? x[local_unknown] : 0.0;
+      product_nodal[l] = 0.0;
+    }
+
+    // The Jacobian matrix is the discrete Laplace operator
+    add_laplace_operator_by_sum_factorisation(g, x_nodal, product_nodal);
+
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      const int local_eqn = this->nodal_local_eqn(l, u_nodal_index);
+      if (local_eqn >= 0)
+      {
+        product[local_eqn] += product_nodal[l];
+      }
+    }
+  }
+
+
+  //======================================================================
+  /// Compute the diagonal of the element's Jacobian matrix (indexed by
+  /// the local equation numbers). With sum factorisation, the diagonal
+  /// entry for node l is sum_ij sum_ipt g_ij(ipt) dpsi_l/ds_i dpsi_l/ds_j,
+  /// which is the integral over the knots of g_ij with the
+  /// one-dimensional matrices replaced by the entrywise products of those
+  /// for the i-th and j-th local derivatives.
+  //======================================================================
+  template<unsigned DIM, unsigned NNODE_1D>
+  void QSpectralPoissonElement<DIM, NNODE_1D>::get_jacobian_diagonal(
+    Vector<double>& diagonal)
+  {
+    const unsigned n_dof = this->ndof();
+    diagonal.assign(n_dof, 0.0);
+
+    // Extract the diagonal of the elemental Jacobian matrix if we can't
+    // use sum factorisation
+    if (!sum_factorisation_is_applicable())
+    {
+      Vector<double> residuals(n_dof);
+      DenseMatrix<double> jacobian(n_dof);
+      this->get_jacobian(residuals, jacobian);
+      for (unsigned i = 0; i < n_dof; i++)
+      {
+        diagonal[i] = jacobian(i, i);
+      }
+      return;
+    }
+
+    const unsigned n_node = SumFactorisation::Nnode;
+    const unsigned n_knot = SumFactorisation::Nknot;
+    const unsigned n_matrix = NNODE_1D * NNODE_1D;
+    const unsigned u_nodal_index = this->u_index_poisson();
+
+    double g[DIM * DIM * SumFactorisation::Nknot];
+    double W[SumFactorisation::Nknot];
+    get_geometric_factors_by_sum_factorisation(g, W);
+
+    // Entrywise products of the one-dimensional matrices
+    const double* const psi = &SumFactorisation::Psi[0];
+    const double* const dpsi = &SumFactorisation::Dpsi[0];
+    double psi_psi[NNODE_1D * NNODE_1D];
+    double psi_dpsi[NNODE_1D * NNODE_1D];
+    double dpsi_dpsi[NNODE_1D * NNODE_1D];
+    for (unsigned m = 0; m < n_matrix; m++)
+    {
+      psi_psi[m] = psi[m] * psi[m];
+      psi_dpsi[m] = psi[m] * dpsi[m];
+      dpsi_dpsi[m] = dpsi[m] * dpsi[m];
+    }
+
+    double diagonal_nodal[SumFactorisation::Nnode];
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      diagonal_nodal[l] = 0.0;
+    }
+    const double* a_product[DIM];
+    for (unsigned i = 0; i < DIM; i++)
+    {
+      for (unsigned j = 0; j < DIM; j++)
+      {
+        for (unsigned d = 0; d < DIM; d++)
+        {
+          if ((d == i) && (d == j))
+          {
+            a_product[d] = dpsi_dpsi;
+          }
+          else if ((d == i) || (d == j))
+          {
+            a_product[d] = psi_dpsi;
+          }
+          else
+          {
+            a_product[d] = psi_psi;
+          }
+        }
+        SumFactorisation::add_integral_over_knots(
+          a_product, &g[(DIM * i + j) * n_knot], diagonal_nodal);
+      }
+    }
+
+    for (unsigned l = 0; l < n_node; l++)
+    {
+      const int local_eqn = this->nodal_local_eqn(l, u_nodal_index);
+      if (local_eqn >= 0)
+      {
+        diagonal[local_eqn] += diagonal_nodal[l];
+      }
+    }
+  }
+
+
   template class QSpectralPoissonElement<1, 2>;
   template class QSpectralPoissonElement<1, 3>;
   template class QSpectralPoissonElement<1, 4>;
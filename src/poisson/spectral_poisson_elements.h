@@ -41,9 +41,14 @@ namespace oomph
   //======================================================================
   /// QSpectralPoissonElement elements are linear/quadrilateral/brick-shaped
   /// Poisson elements with isoparametric spectral interpolation for the
-  /// function. Note that the implementation is PoissonEquations<DIM> does
+  /// function. Note that the implementation in PoissonEquations<DIM> does
   /// not use sum factorisation for the evaluation of the residuals and is,
-  /// therefore, not optimal for higher dimensions.
+  /// therefore, not optimal for higher dimensions. The element therefore
+  /// also provides sum-factorised versions of the residuals (see
+  /// enable_sum_factorisation()), of the product of its Jacobian matrix
+  /// with a vector and of the diagonal of its Jacobian matrix; the latter
+  /// two are used by MatrixFreeSpectralPoissonJacobian
+  /// (see spectral_poisson_matrix_free_jacobian.h).
   //======================================================================
   template<unsigned DIM, unsigned NNODE_1D>
   class QSpectralPoissonElement
@@ -55,12 +60,23 @@ namespace oomph
     /// nodes: Initial_Nvalue[n]
     static const unsigned Initial_Nvalue;
 
+    /// \short Sum-factorisation kernels and one-dimensional matrices for
+    /// the default (Gauss-Lobatto-Legendre) integration scheme
+    typedef SpectralSumFactorisation<DIM, NNODE_1D, NNODE_1D> SumFactorisation;
+
+    /// \short Boolean flag to indicate if the residuals are to be computed
+    /// by sum factorisation
+    bool Use_sum_factorisation;
+
   public:
     ///\short  Constructor: Call constructors for QSpectralElement and
     /// Poisson equations
     QSpectralPoissonElement()
-      : QSpectralElement<DIM, NNODE_1D>(), PoissonEquations<DIM>()
+      : QSpectralElement<DIM, NNODE_1D>(),
+        PoissonEquations<DIM>(),
+        Use_sum_factorisation(false)
     {
+      SumFactorisation::calculate_one_d_matrices();
     }
 
     /// Broken copy constructor
@@ -87,6 +103,42 @@ namespace oomph
       return Initial_Nvalue;
     }
 
+    /// \short Compute the residuals by sum factorisation (where
+    /// applicable, see sum_factorisation_is_applicable())
+    void enable_sum_factorisation()
+    {
+      Use_sum_factorisation = true;
+    }
+
+    /// \short Compute the residuals with the generic code in
+    /// PoissonEquations<DIM> (default)
+    void disable_sum_factorisation()
+    {
+      Use_sum_factorisation = false;
+    }
+
+    /// \short Can the sum-factorised kernels be used? This requires
+    /// the default (Gauss-Lobatto-Legendre) integration scheme and no
+    /// hanging nodes.
+    bool sum_factorisation_is_applicable() const;
+
+    /// \short Add the element's contribution to its residual vector;
+    /// computed by sum factorisation if this has been enabled and is
+    /// applicable.
+    void fill_in_contribution_to_residuals(Vector<double>& residuals);
+
+    /// \short Compute the product of the element's Jacobian matrix with
+    /// the vector x without assembling the matrix; both x and product are
+    /// indexed by the local equation numbers. Uses sum factorisation if
+    /// applicable and the elemental Jacobian matrix otherwise.
+    void get_jacobian_vector_product(const Vector<double>& x,
+                                     Vector<double>& product);
+
+    /// \short Compute the diagonal of the element's Jacobian matrix,
+    /// indexed by the local equation numbers. Uses sum factorisation if
+    /// applicable and the elemental Jacobian matrix otherwise.
+    void get_jacobian_diagonal(Vector<double>& diagonal);
+
     /// \short Output function:
     ///  x,y,u   or    x,y,z,u
     void output(std::ostream& outfile)
@@ -171,6 +223,22 @@ namespace oomph
       DShape& dtestdx,
       RankFourTensor<double>& d_dtestdx_dX,
       DenseMatrix<double>& djacobian_dX) const;
+
+  private:
+    /// \short Get the geometric factors at the knots of the default
+    /// integration scheme, premultiplied by the integration weights:
+    /// g[(DIM*i+j)*SumFactorisation::Nknot+ipt] =
+    /// W sum_k (ds_i/dx_k)(ds_j/dx_k), and the weights themselves,
+    /// W[ipt] = w(ipt) J(ipt).
+    void get_geometric_factors_by_sum_factorisation(double* const& g,
+                                                    double* const& W) const;
+
+    /// \short Add the discrete Laplace operator (defined by the geometric
+    /// factors g), applied to the nodal values u_nodal, to result_nodal
+    void add_laplace_operator_by_sum_factorisation(
+      const double* const& g,
+      const double* const& u_nodal,
+      double* const& result_nodal) const;
   };
 
 
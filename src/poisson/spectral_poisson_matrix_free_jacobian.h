@@ -0,0 +1,221 @@
+// LIC// ====================================================================
+// LIC// This file forms part of oomph-lib, the object-oriented,
+// LIC// multi-physics finite-element library, available
+// LIC// at http://www.oomph-lib.org.
+// LIC//
+// LIC// Copyright (C) 2006-2021 Matthias Heil and Andrew Hazel
+// LIC//
+// LIC// This library is free software; you can redistribute it and/or
+// LIC// modify it under the terms of the GNU Lesser General Public
+// LIC// License as published by the Free Software Foundation; either
+// LIC// version 2.1 of the License, or (at your option) any later version.
+// LIC//
+// LIC// This library is distributed in the hope that it will be useful,
+// LIC// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// LIC// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// LIC// Lesser General Public License for more details.
+// LIC//
+// LIC// You should have received a copy of the GNU Lesser General Public
+// LIC// License along with this library; if not, write to the Free Software
+// LIC// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+// LIC// 02110-1301  USA.
+// LIC//
+// LIC// The authors may be contacted at oomph-lib@maths.man.ac.uk.
+// LIC//
+// LIC//====================================================================
+// Header file for the matrix-free Jacobian of spectral Poisson problems
+#ifndef OOMPH_SPECTRAL_POISSON_MATRIX_FREE_JACOBIAN_HEADER
+#define OOMPH_SPECTRAL_POISSON_MATRIX_FREE_JACOBIAN_HEADER
+
+// Config header generated by autoconfig
+#ifdef HAVE_CONFIG_H
+#include <oomph-lib-config.h>
+#endif
+
+// OOMPH-LIB headers
+#include "../generic/matrices.h"
+#include "../generic/problem.h"
+#include "spectral_poisson_elements.h"
+
+namespace oomph
+{
+  //======================================================================
+  /// \short Matrix-free representation of the Jacobian matrix of a
+  /// Problem whose mesh contains QSpectralPoissonElements of type ELEMENT.
+  /// Products with the matrix are computed element by element (by sum
+  /// factorisation where applicable) without assembling the matrix. Only
+  /// the diagonal entries are stored and accessible via operator(), so the
+  /// operator can be used with MatrixBasedDiagPreconditioner, e.g. as
+  /// the matrix passed to CG<CRDoubleMatrix>::solve(...). Elements that
+  /// are not of type ELEMENT (e.g. PoissonFluxElements with a prescribed
+  /// flux) are assumed not to contribute to the Jacobian matrix. The
+  /// Problem must not be distributed.
+  //======================================================================
+  template<class ELEMENT>
+  class MatrixFreeSpectralPoissonJacobian : public DoubleMatrixBase
+  {
+  public:
+    /// \short Constructor: Pass the pointer to the problem (whose equation
+    /// numbers must have been assigned) and compute the diagonal
+    MatrixFreeSpectralPoissonJacobian(Problem* problem_pt)
+      : Problem_pt(problem_pt)
+    {
+#ifdef OOMPH_HAS_MPI
+#ifdef PARANOID
+      if (problem_pt->distributed())
+      {
+        throw OomphLibError(
+          "MatrixFreeSpectralPoissonJacobian does not work for distributed "
+          "problems",
+          OOMPH_CURRENT_FUNCTION,
+          OOMPH_EXCEPTION_LOCATION);
+      }
+#endif
+#endif
+      update_diagonal();
+    }
+
+    /// Broken copy constructor
+    MatrixFreeSpectralPoissonJacobian(
+      const MatrixFreeSpectralPoissonJacobian<ELEMENT>&)
+    {
+      BrokenCopy::broken_copy("MatrixFreeSpectralPoissonJacobian");
+    }
+
+    /// Broken assignment operator
+    void operator=(const MatrixFreeSpectralPoissonJacobian<ELEMENT>&)
+    {
+      BrokenCopy::broken_assign("MatrixFreeSpectralPoissonJacobian");
+    }
+
+    /// Empty destructor
+    ~MatrixFreeSpectralPoissonJacobian() {}
+
+    /// Return the number of rows of the matrix
+    unsigned long nrow() const
+    {
+      return Diagonal.size();
+    }
+
+    /// Return the number of columns of the matrix
+    unsigned long ncol() const
+    {
+      return Diagonal.size();
+    }
+
+    /// \short Round brackets to give access to the diagonal entries (the
+    /// off-diagonal entries are not available)
+    double operator()(const unsigned long& i, const unsigned long& j) const
+    {
+      if (i != j)
+      {
+        throw OomphLibError("Only the diagonal entries of a matrix-free "
+                            "operator are available",
+                            OOMPH_CURRENT_FUNCTION,
+                            OOMPH_EXCEPTION_LOCATION);
+      }
+      return Diagonal[i];
+    }
+
+    /// \short Multiply the matrix by the vector x: soln=Ax
+    void multiply(const DoubleVector& x, DoubleVector& soln) const
+    {
+#ifdef PARANOID
+      if (x.nrow() != nrow())
+      {
+        std::ostringstream error_message_stream;
+        error_message_stream << "The x vector has " << x.nrow()
+                             << " rows but the matrix has " << nrow()
+                             << " rows.";
+        throw OomphLibError(error_message_stream.str(),
+                            OOMPH_CURRENT_FUNCTION,
+                            OOMPH_EXCEPTION_LOCATION);
+      }
+      if (x.distributed())
+      {
+        throw OomphLibError("The x vector must not be distributed",
+                            OOMPH_CURRENT_FUNCTION,
+                            OOMPH_EXCEPTION_LOCATION);
+      }
+#endif
+
+      // Set up (or zero) the result
+      if (!soln.built())
+      {
+        soln.build(x.distribution_pt(), 0.0);
+      }
+      else
+      {
+        soln.initialise(0.0);
+      }
+
+      const double* x_values = x.values_pt();
+      double* soln_values = soln.values_pt();
+
+      // Loop over the elements and add their contributions
+      Vector<double> x_local;
+      Vector<double> product_local;
+      Mesh* mesh_pt = Problem_pt->mesh_pt();
+      const unsigned n_element = mesh_pt->nelement();
+      for (unsigned e = 0; e < n_element; e++)
+      {
+        ELEMENT* el_pt = dynamic_cast<ELEMENT*>(mesh_pt->element_pt(e));
+        if (el_pt != 0)
+        {
+          const unsigned n_dof = el_pt->ndof();
+          x_local.resize(n_dof);
+          for (unsigned i = 0; i < n_dof; i++)
+          {
+            x_local[i] = x_values[el_pt->eqn_number(i)];
+          }
+          el_pt->get_jacobian_vector_product(x_local, product_local);
+          for (unsigned i = 0; i < n_dof; i++)
+          {
+            soln_values[el_pt->eqn_number(i)] += product_local[i];
+          }
+        }
+      }
+    }
+
+    /// \short Multiply the transposed matrix by the vector x: soln=A^T x
+    /// (the matrix is symmetric)
+    void multiply_transpose(const DoubleVector& x, DoubleVector& soln) const
+    {
+      multiply(x, soln);
+    }
+
+    /// \short (Re-)compute the diagonal of the matrix, e.g. after the
+    /// equation numbering or the mesh has changed
+    void update_diagonal()
+    {
+      Diagonal.assign(Problem_pt->ndof(), 0.0);
+
+      Vector<double> diagonal_local;
+      Mesh* mesh_pt = Problem_pt->mesh_pt();
+      const unsigned n_element = mesh_pt->nelement();
+      for (unsigned e = 0; e < n_element; e++)
+      {
+        ELEMENT* el_pt = dynamic_cast<ELEMENT*>(mesh_pt->element_pt(e));
+        if (el_pt != 0)
+        {
+          el_pt->get_jacobian_diagonal(diagonal_local);
+          const unsigned n_dof = el_pt->ndof();
+          for (unsigned i = 0; i < n_dof; i++)
+          {
+            Diagonal[el_pt->eqn_number(i)] += diagonal_local[i];
+          }
+        }
+      }
+    }
+
+  private:
+    /// Pointer to the problem
+    Problem* Problem_pt;
+
+    /// Diagonal entries of the matrix
+    Vector<double> Diagonal;
+  };
+
+} // namespace oomph
+
+#endif